@@ -0,0 +1,102 @@
+#include <iostream>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "BenchmarkEnvironment.hpp"
+
+bool BenchmarkEnvironment::setUp()
+{
+	if (!glfwInit())
+	{
+		std::cerr << "Failed to initialize GLFW" << std::endl;
+		return false;
+	}
+
+	// OpenGL version 4.6
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+#ifdef __APPLE__
+	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
+#endif
+
+	// Create GLFW window
+	auto window = glfwCreateWindow(1, 1, "Benchmark Window", nullptr, nullptr);
+	if (!window)
+	{
+		glfwTerminate();
+		std::cerr << "Failed to create GLFW window" << std::endl;
+		return false;
+	}
+	glfwMakeContextCurrent(window);
+
+	// Load OpenGL
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	{
+		glfwTerminate();
+		std::cerr << "Failed to load OpenGL functions" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+////////////////////////////////////////////////////////////
+
+void BenchmarkEnvironment::tearDown()
+{
+    if(auto* context = glfwGetCurrentContext())
+    {
+        glfwDestroyWindow(context);
+    }
+    glfwTerminate();
+}
+
+////////////////////////////////////////////////////////////
+
+bool BenchmarkEnvironment::add(std::string name, Function function)
+{
+    _benchmarks().emplace_back(std::move(name), std::move(function));
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+
+void BenchmarkEnvironment::runAll()
+{
+    for(auto& [name, function] : _benchmarks())
+    {
+        std::cout << "[ RUN ] " << name << std::endl;
+        function();
+    }
+}
+
+////////////////////////////////////////////////////////////
+
+void BenchmarkEnvironment::measure(const std::string& name, size_t iterations, const Function& function)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Warm up the driver before measuring
+    function();
+    glFinish();
+
+    auto start = Clock::now();
+    for(size_t i = 0; i < iterations; i++)
+    {
+        function();
+        glFinish();
+    }
+    std::chrono::duration<double, std::micro> elapsed = Clock::now() - start;
+
+    std::cout << "    " << name << ": " << elapsed.count() / iterations << " us" << std::endl;
+}
+
+////////////////////////////////////////////////////////////
+
+std::vector<std::pair<std::string, BenchmarkEnvironment::Function>>& BenchmarkEnvironment::_benchmarks()
+{
+    static std::vector<std::pair<std::string, Function>> benchmarks;
+    return benchmarks;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+///
+/// @class BenchmarkEnvironment
+/// @brief Hidden OpenGL context and registry of the benchmarks
+///
+class BenchmarkEnvironment
+{
+public:
+    using Function = std::function<void()>;
+
+    /// @brief Creates the hidden window with OpenGL 4.6 context
+    /// @return True if success else false
+    static bool setUp();
+
+    /// @brief Destroys the window and terminates GLFW
+    static void tearDown();
+
+    /// @brief Registers the benchmark to run
+    /// @param name Benchmark name
+    /// @param function Benchmark body
+    /// @return Always true, used for static registration
+    static bool add(std::string name, Function function);
+
+    /// @brief Runs all registered benchmarks
+    static void runAll();
+
+    /// @brief Measures the average time of the function, waiting for the GPU after each iteration
+    /// @param name Measurement name
+    /// @param iterations Number of iterations
+    /// @param function Function to measure
+    static void measure(const std::string& name, size_t iterations, const Function& function);
+private:
+    static std::vector<std::pair<std::string, Function>>& _benchmarks();
+};
+
+#define BW_BENCHMARK(name) \
+    static void name(); \
+    static bool name##_registered = BenchmarkEnvironment::add(#name, name); \
+    static void name()
@@ -0,0 +1,47 @@
+#include <vector>
+#include <glad/glad.h>
+#include "BenchmarkEnvironment.hpp"
+#include <graphics/VertexBuffer.hpp>
+
+using namespace bw::low_level;
+
+// Number of vertices rewritten every "frame"
+const size_t FrameVertices = 1 << 16;
+
+// Number of frames measured in one iteration
+const size_t FrameCount = 16;
+
+////////////////////////////////////////////////////////////
+
+// Simulates a frame that reads the dynamic buffer on the GPU and then rewrites it on the CPU.
+// The copy into the sink keeps the GPU busy with the old contents while the new ones are uploaded
+template <typename TUpdate>
+void rewriteFrames(VertexBuffer& buffer, VertexBuffer& sink, std::vector<Vertex>& vertices, TUpdate update)
+{
+    for(size_t i = 0; i < FrameCount; i++)
+    {
+        glCopyNamedBufferSubData(buffer.getNativeHandle(), sink.getNativeHandle(), 0, 0, buffer.capacity());
+        update(buffer, vertices);
+    }
+}
+
+////////////////////////////////////////////////////////////
+
+BW_BENCHMARK(VertexBuffer_Orphaning)
+{
+    std::vector<Vertex> vertices(FrameVertices);
+    VertexBuffer buffer(BufferUsage::Dynamic, FrameVertices);
+    VertexBuffer sink(BufferUsage::Dynamic, FrameVertices);
+
+    BenchmarkEnvironment::measure("update", 20, [&]() {
+        rewriteFrames(buffer, sink, vertices, [](VertexBuffer& target, std::vector<Vertex>& data) {
+            target.update(data);
+        });
+    });
+
+    BenchmarkEnvironment::measure("updateDiscard", 20, [&]() {
+        rewriteFrames(buffer, sink, vertices, [](VertexBuffer& target, std::vector<Vertex>& data) {
+            target.updateDiscard(data);
+        });
+    });
+}
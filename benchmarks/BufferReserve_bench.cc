@@ -0,0 +1,47 @@
+#include <vector>
+#include <glad/glad.h>
+#include "BenchmarkEnvironment.hpp"
+#include <graphics/VertexBuffer.hpp>
+#include <graphics/ElementBuffer.hpp>
+
+using namespace bw::low_level;
+
+// Number of vertices in the "large static mesh" before it grows
+const size_t MeshSize = 1 << 20;
+
+////////////////////////////////////////////////////////////
+
+BW_BENCHMARK(VertexBuffer_Reserve)
+{
+    std::vector<Vertex> vertices(MeshSize);
+
+    // The old growth path: read the buffer back to the CPU and upload it again
+    BenchmarkEnvironment::measure("CPU round trip", 20, [&]() {
+        VertexBuffer buffer(BufferUsage::Static, vertices);
+        std::vector<Vertex> oldData { buffer.data() };
+        glNamedBufferData(buffer.getNativeHandle(), 2 * MeshSize * sizeof(Vertex), oldData.data(), GL_STATIC_DRAW);
+    });
+
+    BenchmarkEnvironment::measure("GPU copy", 20, [&]() {
+        VertexBuffer buffer(BufferUsage::Static, vertices);
+        buffer.reserve(2 * MeshSize);
+    });
+}
+
+////////////////////////////////////////////////////////////
+
+BW_BENCHMARK(ElementBuffer_Reserve)
+{
+    std::vector<unsigned int> indices(MeshSize);
+
+    BenchmarkEnvironment::measure("CPU round trip", 20, [&]() {
+        ElementBuffer buffer(BufferUsage::Static, indices);
+        std::vector<unsigned int> oldData { buffer.data() };
+        glNamedBufferData(buffer.getNativeHandle(), 2 * MeshSize * sizeof(unsigned int), oldData.data(), GL_STATIC_DRAW);
+    });
+
+    BenchmarkEnvironment::measure("GPU copy", 20, [&]() {
+        ElementBuffer buffer(BufferUsage::Static, indices);
+        buffer.reserve(2 * MeshSize);
+    });
+}
@@ -0,0 +1,12 @@
+#include "BenchmarkEnvironment.hpp"
+
+int main()
+{
+    if(!BenchmarkEnvironment::setUp())
+        return 1;
+
+    BenchmarkEnvironment::runAll();
+    BenchmarkEnvironment::tearDown();
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <span>
+#include "IBufferStorage.hpp"
+#include "SliceAllocator.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @class BufferArena
+    /// @brief Sub-allocator that packs many small meshes into one buffer storage and hands out slices of it
+    /// 
+    /// All slices share one buffer object, so the meshes can be drawn from one vertex array binding
+    /// with the slice offset passed as the first vertex or the base vertex.
+    /// When no free range is large enough the storage grows geometrically, the data and the offsets
+    /// of the allocated slices stay valid. The arena does not own the storage, it must outlive the arena.
+    /// 
+    /// @tparam T Buffer data type
+    ///
+    template <typename T>
+    class BufferArena
+    {
+    public:
+        /// @brief Default factor of the capacity growth
+        static constexpr float DefaultGrowthFactor = 1.5f;
+
+        /// @brief Minimal number of elements allocated by the first growth
+        static constexpr size_t MinCapacity = 1024;
+
+        /// @brief Creates arena over the whole storage. The current contents of the storage are considered free
+        /// @param storage Buffer storage that holds the slices
+        /// @param growthFactor Factor of the capacity growth (must be greater than 1)
+        /// @throw std::invalid_argument If the storage is a stream ring
+        BufferArena(IBufferStorage<T>& storage, float growthFactor = DefaultGrowthFactor);
+
+        /// @brief Allocates a slice of the storage without initializing it
+        /// @param count Number of elements
+        /// @return Allocated slice
+        BufferSlice allocate(size_t count);
+
+        /// @brief Allocates a slice of the storage and fills it with the data
+        /// @param data Initialization data
+        /// @return Allocated slice
+        BufferSlice allocate(std::span<const T> data);
+
+        /// @brief Updates contents of the slice
+        /// @param slice Slice to update
+        /// @param data New data (must fit into the slice)
+        void update(BufferSlice slice, std::span<const T> data);
+
+        /// @brief Returns the slice to the arena, its memory can be reused by next allocations
+        /// @param slice Slice to free
+        void free(BufferSlice slice);
+
+        /// @brief Frees all slices without releasing the storage memory
+        void clear();
+
+        /// @brief Gets the number of allocated elements
+        /// @return Used elements
+        size_t used() const;
+
+        /// @brief Gets the number of elements the storage can hold without reallocation
+        /// @return Capacity in number of elements
+        size_t capacity() const;
+
+        /// @brief Gets the storage of the arena
+        /// @return Buffer storage
+        IBufferStorage<T>& getStorage() const;
+    private:
+        IBufferStorage<T>* _storage;
+        SliceAllocator _allocator;
+        float _growthFactor;
+    };
+}
+
+#include "BufferArena.tpp"
@@ -0,0 +1,99 @@
+#ifndef BUFFERARENA_TPP
+#define BUFFERARENA_TPP
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace bw::low_level
+{
+    template <typename T>
+    BufferArena<T>::BufferArena(IBufferStorage<T>& storage, float growthFactor) 
+        : _storage(&storage), _allocator(storage.size()), _growthFactor(std::max(growthFactor, 1.0f))
+    {
+        if (storage.isStreaming())
+            throw std::invalid_argument("Stream rings address the current frame and cannot back an arena");
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    BufferSlice BufferArena<T>::allocate(size_t count)
+    {
+        if (auto slice = _allocator.allocate(count))
+            return *slice;
+
+        // The free tail is merged with the grown range, so the allocation always succeeds after the growth
+        size_t currentCapacity = _allocator.capacity();
+        size_t grown = static_cast<size_t>(currentCapacity * _growthFactor);
+        size_t newCapacity = std::max({ currentCapacity + count, grown, MinCapacity });
+
+        _storage->reserve(newCapacity);
+        _allocator.grow(newCapacity);
+
+        return *_allocator.allocate(count);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    BufferSlice BufferArena<T>::allocate(std::span<const T> data)
+    {
+        BufferSlice slice = allocate(data.size());
+        update(slice, data);
+        return slice;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void BufferArena<T>::update(BufferSlice slice, std::span<const T> data)
+    {
+        if (data.size() > slice.count)
+            throw std::out_of_range("The data does not fit into the slice");
+
+        if (!data.empty())
+            _storage->update(slice.offset, data);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void BufferArena<T>::free(BufferSlice slice)
+    {
+        _allocator.free(slice);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void BufferArena<T>::clear()
+    {
+        _allocator.reset();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    size_t BufferArena<T>::used() const
+    {
+        return _allocator.used();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    size_t BufferArena<T>::capacity() const
+    {
+        return _allocator.capacity();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    IBufferStorage<T>& BufferArena<T>::getStorage() const
+    {
+        return *_storage;
+    }
+}
+
+#endif
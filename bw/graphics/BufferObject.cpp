@@ -0,0 +1,277 @@
+#include <cstring>
+#include <stdexcept>
+#include <glad/glad.h>
+#include "BufferObject.hpp"
+
+namespace bw::low_level
+{
+    GLenum bo_bufferUsageToGLEnum(BufferUsage usage)
+    {
+        switch(usage)
+        {
+            case BufferUsage::Static:  return GL_STATIC_DRAW;
+            case BufferUsage::Dynamic: return GL_DYNAMIC_DRAW;
+            default:                   return GL_STREAM_DRAW;
+        }
+    }
+
+    GLenum bo_bufferTargetToGLEnum(BufferTarget target)
+    {
+        switch(target)
+        {
+            case BufferTarget::ArrayTarget:         return GL_ARRAY_BUFFER;
+            case BufferTarget::ElementArrayTarget:  return GL_ELEMENT_ARRAY_BUFFER;
+            case BufferTarget::UniformTarget:       return GL_UNIFORM_BUFFER;
+            case BufferTarget::ShaderStorageTarget: return GL_SHADER_STORAGE_BUFFER;
+            case BufferTarget::DrawIndirectTarget:  return GL_DRAW_INDIRECT_BUFFER;
+            default:                                return GL_DISPATCH_INDIRECT_BUFFER;
+        }
+    }
+
+    GLenum bo_indexedTargetToGLEnum(BufferTarget target)
+    {
+        if (target != BufferTarget::UniformTarget && target != BufferTarget::ShaderStorageTarget)
+            throw std::invalid_argument("Only uniform and shader storage buffers have indexed binding points");
+
+        return bo_bufferTargetToGLEnum(target);
+    }
+
+    // Flags of the immutable storage and its persistent mapping
+    const GLbitfield bo_persistentFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	////////////////////////////////////////////////////////////
+
+    BufferObject::BufferObject(BufferUsage usage, const void* data, size_t size) : _handle(NullBuffer), _capacity(size), _usage(usage), _persistent(nullptr)
+    {
+        glCreateBuffers(1, &_handle);
+        glNamedBufferData(_handle, size, data, bo_bufferUsageToGLEnum(usage));
+    }
+
+	////////////////////////////////////////////////////////////
+
+    BufferObject::BufferObject(BufferObject&& moved) noexcept : _handle(moved._handle), _capacity(moved._capacity), _usage(moved._usage), _persistent(moved._persistent)
+    {
+        moved._handle = NullBuffer;
+        moved._capacity = 0;
+        moved._persistent = nullptr;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    BufferObject::~BufferObject()
+    {
+        release();
+    }
+
+	////////////////////////////////////////////////////////////
+
+    BufferObject& BufferObject::operator=(BufferObject&& moved) noexcept
+    {
+        if (this != &moved)
+        {
+            release();
+
+            _handle = moved._handle;
+            _capacity = moved._capacity;
+            _usage = moved._usage;
+            _persistent = moved._persistent;
+
+            moved._handle = NullBuffer;
+            moved._capacity = 0;
+            moved._persistent = nullptr;
+        }
+        return *this;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::reserve(size_t size)
+    {
+        if (size <= _capacity) return;
+        if (_persistent)
+            throw std::logic_error("Persistent buffer storage cannot grow");
+
+        GLenum usage = bo_bufferUsageToGLEnum(_usage);
+        if (_capacity == 0)
+        {
+            glNamedBufferData(_handle, size, nullptr, usage);
+            _capacity = size;
+            return;
+        }
+
+        // Old contents are moved through a scratch buffer on the GPU side,
+        // so the handle stays the same for the vertex arrays and binding points that use it
+        unsigned int scratch;
+        glCreateBuffers(1, &scratch);
+        glNamedBufferData(scratch, _capacity, nullptr, GL_STREAM_COPY);
+        glCopyNamedBufferSubData(_handle, scratch, 0, 0, _capacity);
+
+        glNamedBufferData(_handle, size, nullptr, usage);
+        glCopyNamedBufferSubData(scratch, _handle, 0, 0, _capacity);
+        glDeleteBuffers(1, &scratch);
+        _capacity = size;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::update(size_t offset, const void* data, size_t size)
+    {
+        if (size == 0) return;
+
+        if (_persistent)
+        {
+            std::memcpy(static_cast<std::byte*>(_persistent) + offset, data, size);
+            return;
+        }
+
+        glNamedBufferSubData(_handle, offset, size, data);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::updateDiscard(const void* data, size_t size)
+    {
+        if (_persistent)
+            throw std::logic_error("Persistent buffer storage cannot be orphaned");
+
+        GLenum usage = bo_bufferUsageToGLEnum(_usage);
+        if (size > _capacity)
+        {
+            glNamedBufferData(_handle, size, data, usage);
+            _capacity = size;
+            return;
+        }
+
+        // Re-specifying the storage with the same size orphans the old memory
+        glNamedBufferData(_handle, _capacity, nullptr, usage);
+        glNamedBufferSubData(_handle, 0, size, data);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::read(size_t offset, void* out, size_t size) const
+    {
+        if (size == 0) return;
+
+        // The persistent mapping is write-only and write-combined, so it is never read directly.
+        // The query also waits for the GPU commands that write the range
+        glGetNamedBufferSubData(_handle, offset, size, out);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::copyTo(BufferObject& buffer, size_t srcOffset, size_t dstOffset, size_t size) const
+    {
+        if (size == 0) return;
+
+        glCopyNamedBufferSubData(_handle, buffer._handle, srcOffset, dstOffset, size);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void* BufferObject::storePersistent(size_t size)
+    {
+        // Storage of the buffer handle cannot be respecified after glNamedBufferStorage, so the handle is recreated
+        release();
+        glCreateBuffers(1, &_handle);
+        glNamedBufferStorage(_handle, size, nullptr, bo_persistentFlags);
+
+        _persistent = glMapNamedBufferRange(_handle, 0, size, bo_persistentFlags);
+        _capacity = size;
+        return _persistent;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void* BufferObject::getPersistentMapping() const
+    {
+        return _persistent;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    bool BufferObject::isPersistent() const
+    {
+        return _persistent != nullptr;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    const void* BufferObject::mapRead() const
+    {
+        if (_persistent)
+            throw std::logic_error("Persistent storage is mapped for writing only, use read() instead");
+
+        return glMapNamedBufferRange(_handle, 0, _capacity, GL_MAP_READ_BIT);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::unmapRead() const
+    {
+        if (!_persistent)
+            glUnmapNamedBuffer(_handle);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::bind(BufferTarget target) const
+    {
+        glBindBuffer(bo_bufferTargetToGLEnum(target), _handle);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::bindBase(BufferTarget target, unsigned int index) const
+    {
+        glBindBufferBase(bo_indexedTargetToGLEnum(target), index, _handle);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::bindRange(BufferTarget target, unsigned int index, size_t offset, size_t size) const
+    {
+        if (offset + size > _capacity)
+            throw std::out_of_range("The bound range is out of the buffer");
+
+        glBindBufferRange(bo_indexedTargetToGLEnum(target), index, _handle, offset, size);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    size_t BufferObject::capacity() const
+    {
+        return _capacity;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    BufferUsage BufferObject::getUsage() const
+    {
+        return _usage;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    unsigned int BufferObject::getNativeHandle() const
+    {
+        return _handle;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferObject::release()
+    {
+        if (_handle != NullBuffer)
+        {
+            if (_persistent)
+            {
+                glUnmapNamedBuffer(_handle);
+                _persistent = nullptr;
+            }
+            glDeleteBuffers(1, &_handle);
+            _handle = NullBuffer;
+            _capacity = 0;
+        }
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include "IBufferStorage.hpp"
+#include "IResource.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @enum BufferTarget
+    /// @brief Binding point the buffer data is used through
+    ///
+    enum BufferTarget
+    {
+        ArrayTarget,           // Vertex attributes
+        ElementArrayTarget,    // Vertex indices
+        UniformTarget,         // Uniform blocks
+        ShaderStorageTarget,   // Shader storage blocks
+        DrawIndirectTarget,    // Indirect draw commands
+        DispatchIndirectTarget // Indirect compute dispatch commands
+    };
+
+    ///
+    /// @class BufferObject
+    /// @brief Untyped storage of the OpenGL buffer objects that contains all the driver calls of the typed buffers.
+    /// Sizes and offsets are in bytes
+    /// @implements IResource<unsigned int>
+    ///
+    class BufferObject : public IResource<unsigned int>
+    {
+    public:
+        /// @brief Constant for a non-existent buffer
+        static const unsigned int NullBuffer = 0;
+
+        /// @brief Creates a buffer and allocates its memory
+        /// @param usage Buffer usage type
+        /// @param data Initialization data (may be nullptr)
+        /// @param size Size of the memory in bytes
+        BufferObject(BufferUsage usage, const void* data = nullptr, size_t size = 0);
+
+        BufferObject(const BufferObject&) = delete;
+        BufferObject(BufferObject&& moved) noexcept;
+
+        ~BufferObject();
+
+        BufferObject& operator=(const BufferObject&) = delete;
+        BufferObject& operator=(BufferObject&& moved) noexcept;
+
+        /// @brief Grows the buffer memory keeping the old contents and the handle
+        /// @param size New size in bytes (ignored if not bigger than the current one)
+        /// @throw std::logic_error If the storage is persistently mapped
+        void reserve(size_t size);
+
+        /// @brief Writes the data to the buffer
+        /// @param offset Offset in bytes
+        /// @param data Source data
+        /// @param size Size of the data in bytes
+        void update(size_t offset, const void* data, size_t size);
+
+        /// @brief Orphans the buffer memory and writes the data to the beginning of the new one
+        /// @param data Source data
+        /// @param size Size of the data in bytes (the buffer grows if it does not fit)
+        /// @throw std::logic_error If the storage is persistently mapped
+        void updateDiscard(const void* data, size_t size);
+
+        /// @brief Reads the buffer data into the caller's memory. Persistent storage is read through the driver as well
+        /// @param offset Offset in bytes
+        /// @param out Destination memory
+        /// @param size Size of the data in bytes
+        void read(size_t offset, void* out, size_t size) const;
+
+        /// @brief Copies the data to another buffer (or to another place of this buffer) on the GPU side
+        /// @param buffer Destination buffer
+        /// @param srcOffset Offset in this buffer in bytes
+        /// @param dstOffset Offset in the destination buffer in bytes
+        /// @param size Size of the data in bytes
+        void copyTo(BufferObject& buffer, size_t srcOffset, size_t dstOffset, size_t size) const;
+
+        /// @brief Recreates the buffer with immutable storage that stays mapped for writing.
+        /// The old contents are discarded
+        /// @param size Size of the memory in bytes
+        /// @return Pointer to the mapped memory
+        void* storePersistent(size_t size);
+
+        /// @brief Gets the persistently mapped memory
+        /// @return Pointer to the mapped memory (nullptr if the storage is not persistent)
+        void* getPersistentMapping() const;
+
+        /// @brief Check if the storage is persistently mapped
+        /// @return True if persistent, otherwise false
+        bool isPersistent() const;
+
+        /// @brief Maps the whole buffer for reading
+        /// @return Pointer to the buffer memory, valid until unmapRead() (nullptr if the mapping fails)
+        /// @throw std::logic_error If the storage is persistently mapped, its mapping cannot be read
+        const void* mapRead() const;
+
+        /// @brief Unmaps the buffer mapped by mapRead()
+        void unmapRead() const;
+
+        /// @brief Binds the buffer to the target
+        /// @param target Binding target
+        void bind(BufferTarget target) const;
+
+        /// @brief Binds the whole buffer to the indexed binding point of the target
+        /// @param target UniformBuffer or ShaderStorageBuffer
+        /// @param index Binding point index
+        void bindBase(BufferTarget target, unsigned int index) const;
+
+        /// @brief Binds the range of the buffer to the indexed binding point of the target
+        /// @param target UniformBuffer or ShaderStorageBuffer
+        /// @param index Binding point index
+        /// @param offset Offset in bytes (must follow the alignment of the target)
+        /// @param size Size of the range in bytes
+        void bindRange(BufferTarget target, unsigned int index, size_t offset, size_t size) const;
+
+        /// @brief Get the size of the buffer memory. The value is cached and does not query the driver
+        /// @return Size in bytes
+        size_t capacity() const;
+
+        /// @brief Get the usage type of the buffer
+        /// @return Buffer usage type
+        BufferUsage getUsage() const;
+
+        /// @brief Gets buffer native handle
+        /// @return OpenGL buffer handle
+        unsigned int getNativeHandle() const override;
+
+        /// @brief Unmaps and deletes the buffer
+        void release() override;
+    private:
+        unsigned int _handle;
+        size_t _capacity;
+        BufferUsage _usage;
+        void* _persistent;
+    };
+}
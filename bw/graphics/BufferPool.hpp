@@ -0,0 +1,77 @@
+#pragma once
+
+#include <map>
+#include <vector>
+#include <utility>
+#include "IBufferStorage.hpp"
+#include "VertexBuffer.hpp"
+#include "ElementBuffer.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @class BufferPool
+    /// @brief Recycles buffer objects grouped by usage and power-of-two size class
+    /// 
+    /// Acquired buffers hold at least the requested number of elements. Buffers given back with recycle()
+    /// are reused by the next acquisitions of the same class instead of being deleted and created again.
+    /// Buffers that stay unused longer than the idle limit are deleted by nextFrame().
+    /// The contents of the recycled buffers are not cleared.
+    /// 
+    /// @tparam TBuffer Buffer type constructible from the usage and the number of elements (VertexBuffer, ElementBuffer)
+    ///
+    template <typename TBuffer>
+    class BufferPool
+    {
+    public:
+        /// @brief Default number of frames a free buffer is kept
+        static constexpr size_t DefaultMaxIdleFrames = 60;
+
+        /// @brief Creates empty pool
+        /// @param maxIdleFrames Number of frames a free buffer is kept before it is deleted
+        BufferPool(size_t maxIdleFrames = DefaultMaxIdleFrames);
+
+        /// @brief Takes the free buffer of the matching class or creates a new one
+        /// @param usage Buffer usage type
+        /// @param size Minimal number of elements
+        /// @return Buffer with the size rounded up to the power of two
+        TBuffer acquire(BufferUsage usage, size_t size);
+
+        /// @brief Gives the buffer back to the pool
+        /// @param buffer Buffer to reuse, its shadow copy is disabled. Streaming vertex buffers are released instead,
+        /// their frame-relative offsets do not fit the buffers handed out by acquire()
+        void recycle(TBuffer&& buffer);
+
+        /// @brief Advances the frame counter and deletes the buffers that were idle too long
+        void nextFrame();
+
+        /// @brief Deletes all free buffers
+        void clear();
+
+        /// @brief Gets the number of free buffers in the pool
+        /// @return Free buffer count
+        size_t getFreeCount() const;
+
+        /// @brief Gets the size class of the number of elements
+        /// @param size Number of elements
+        /// @return Power of two exponent of the smallest class that holds the elements
+        static size_t getSizeClass(size_t size);
+    private:
+        struct Entry
+        {
+            TBuffer buffer;
+            size_t lastUsedFrame;
+        };
+
+        using Key = std::pair<BufferUsage, size_t>;
+
+        std::map<Key, std::vector<Entry>> _free;
+        size_t _maxIdleFrames;
+        size_t _frame;
+    };
+
+    using VertexBufferPool = BufferPool<VertexBuffer>;
+    using ElementBufferPool = BufferPool<ElementBuffer>;
+}
+
+#include "BufferPool.tpp"
@@ -0,0 +1,96 @@
+#ifndef BUFFERPOOL_TPP
+#define BUFFERPOOL_TPP
+
+#include <bit>
+#include <iterator>
+#include <algorithm>
+
+namespace bw::low_level
+{
+    template <typename TBuffer>
+    BufferPool<TBuffer>::BufferPool(size_t maxIdleFrames) : _maxIdleFrames(maxIdleFrames), _frame(0) { }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TBuffer>
+    TBuffer BufferPool<TBuffer>::acquire(BufferUsage usage, size_t size)
+    {
+        size_t sizeClass = getSizeClass(size);
+
+        auto it = _free.find({ usage, sizeClass });
+        if (it != _free.end() && !it->second.empty())
+        {
+            // The most recently recycled buffer is the most likely to be resident
+            TBuffer buffer = std::move(it->second.back().buffer);
+            it->second.pop_back();
+            return buffer;
+        }
+        return TBuffer(usage, size_t(1) << sizeClass);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TBuffer>
+    void BufferPool<TBuffer>::recycle(TBuffer&& buffer)
+    {
+        size_t size = buffer.size();
+        if (size == 0 || buffer.getNativeHandle() == 0) return;
+
+        if (buffer.isStreaming())
+        {
+            buffer.release();
+            return;
+        }
+
+        buffer.disableShadow();
+
+        // Buffers grown by the user are filed under the largest class they can serve
+        size_t sizeClass = std::bit_width(size) - 1;
+        _free[{ buffer.getUsage(), sizeClass }].push_back({ std::move(buffer), _frame });
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TBuffer>
+    void BufferPool<TBuffer>::nextFrame()
+    {
+        _frame++;
+
+        for (auto it = _free.begin(); it != _free.end(); )
+        {
+            std::erase_if(it->second, [this](const Entry& entry) { return _frame - entry.lastUsedFrame > _maxIdleFrames; });
+            it = it->second.empty() ? _free.erase(it) : std::next(it);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TBuffer>
+    void BufferPool<TBuffer>::clear()
+    {
+        _free.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TBuffer>
+    size_t BufferPool<TBuffer>::getFreeCount() const
+    {
+        size_t count = 0;
+        for (auto& [key, entries] : _free)
+        {
+            count += entries.size();
+        }
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TBuffer>
+    size_t BufferPool<TBuffer>::getSizeClass(size_t size)
+    {
+        return std::bit_width(std::bit_ceil(std::max<size_t>(size, 1))) - 1;
+    }
+}
+
+#endif
@@ -0,0 +1,230 @@
+#include <utility>
+#include <stdexcept>
+#include <glad/glad.h>
+#include "BufferReadback.hpp"
+
+namespace bw::low_level
+{
+    // Flags of the staging storage and its persistent mapping
+    const GLbitfield rb_stagingFlags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    // Alignment of the readbacks in the ring, enough for any element type
+    const size_t rb_alignment = 16;
+
+    size_t rb_alignUp(size_t value)
+    {
+        return (value + rb_alignment - 1) / rb_alignment * rb_alignment;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    BufferReadback::BufferReadback(unsigned int sourceHandle, size_t offset, size_t size) 
+        : _staging(0), _data(nullptr), _size(size), _ring(nullptr), _frame(0)
+    {
+        if (size == 0) return;
+
+        glCreateBuffers(1, &_staging);
+        glNamedBufferStorage(_staging, size, nullptr, rb_stagingFlags | GL_CLIENT_STORAGE_BIT);
+        _data = static_cast<const std::byte*>(glMapNamedBufferRange(_staging, 0, size, rb_stagingFlags));
+
+        glCopyNamedBufferSubData(sourceHandle, _staging, offset, 0, size);
+        _fence.signal();
+    }
+
+	////////////////////////////////////////////////////////////
+
+    BufferReadback::BufferReadback(const ReadbackRing& ring, std::uint64_t frame, const std::byte* data, size_t size)
+        : _staging(0), _data(data), _size(size), _ring(&ring), _frame(frame) { }
+
+	////////////////////////////////////////////////////////////
+
+    BufferReadback::BufferReadback(BufferReadback&& moved) noexcept 
+        : _staging(moved._staging), _fence(std::move(moved._fence)), _data(moved._data), _size(moved._size), 
+          _ring(moved._ring), _frame(moved._frame)
+    {
+        moved._staging = 0;
+        moved._data = nullptr;
+        moved._size = 0;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    BufferReadback::~BufferReadback()
+    {
+        release();
+    }
+
+	////////////////////////////////////////////////////////////
+
+    BufferReadback& BufferReadback::operator=(BufferReadback&& moved) noexcept
+    {
+        if (this != &moved)
+        {
+            release();
+
+            _staging = moved._staging;
+            _fence = std::move(moved._fence);
+            _data = moved._data;
+            _size = moved._size;
+            _ring = moved._ring;
+            _frame = moved._frame;
+
+            moved._staging = 0;
+            moved._data = nullptr;
+            moved._size = 0;
+        }
+        return *this;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    bool BufferReadback::isReady() const
+    {
+        return _fence.isSignaled();
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferReadback::wait() const
+    {
+        _fence.wait();
+    }
+
+	////////////////////////////////////////////////////////////
+
+    std::span<const std::byte> BufferReadback::getBytes()
+    {
+        wait();
+        if (isExpired())
+            throw std::logic_error("The staging memory of the readback has been reused by the ring");
+
+        if (!_data) return {};
+
+        return { _data, _size };
+    }
+
+	////////////////////////////////////////////////////////////
+
+    bool BufferReadback::isExpired() const
+    {
+        return _ring && _ring->_isExpired(_frame);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void BufferReadback::release()
+    {
+        _fence.release();
+        if (_staging)
+        {
+            glDeleteBuffers(1, &_staging);
+            _staging = 0;
+        }
+        _data = nullptr;
+        _size = 0;
+        _ring = nullptr;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    ReadbackRing::ReadbackRing(size_t stagingSize, size_t frameCount) 
+        : _staging(0), _data(nullptr), _capacity(stagingSize), _frameCount(frameCount), _segmentSize(0), _used(0), _frame(0)
+    {
+        if (frameCount == 0)
+            throw std::invalid_argument("Readback ring needs at least one frame");
+
+        // Every segment starts aligned, so the readbacks placed into it stay aligned too
+        _segmentSize = stagingSize / frameCount / rb_alignment * rb_alignment;
+        if (_segmentSize == 0) return;
+
+        glCreateBuffers(1, &_staging);
+        glNamedBufferStorage(_staging, stagingSize, nullptr, rb_stagingFlags | GL_CLIENT_STORAGE_BIT);
+        _data = static_cast<std::byte*>(glMapNamedBufferRange(_staging, 0, stagingSize, rb_stagingFlags));
+
+        if (!_data)
+        {
+            glDeleteBuffers(1, &_staging);
+            throw std::runtime_error("Failed to map the readback staging buffer");
+        }
+    }
+
+	////////////////////////////////////////////////////////////
+
+    ReadbackRing::~ReadbackRing()
+    {
+        release();
+    }
+
+	////////////////////////////////////////////////////////////
+
+    BufferReadback ReadbackRing::readBytes(unsigned int sourceHandle, size_t offset, size_t size)
+    {
+        if (size == 0) return BufferReadback(sourceHandle, offset, size);
+
+        size_t segmentOffset = rb_alignUp(_used);
+        if (!_data || segmentOffset + size > _segmentSize)
+            return BufferReadback(sourceHandle, offset, size);
+
+        size_t stagingOffset = (_frame % _frameCount) * _segmentSize + segmentOffset;
+        _used = segmentOffset + size;
+
+        BufferReadback readback(*this, _frame, _data + stagingOffset, size);
+        glCopyNamedBufferSubData(sourceHandle, _staging, offset, stagingOffset, size);
+        readback._fence.signal();
+
+        return readback;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void ReadbackRing::nextFrame()
+    {
+        _frame++;
+        _used = 0;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    size_t ReadbackRing::getFrameCount() const
+    {
+        return _frameCount;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    size_t ReadbackRing::getStagingSize() const
+    {
+        return _capacity;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    unsigned int ReadbackRing::getNativeHandle() const
+    {
+        return _staging;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void ReadbackRing::release()
+    {
+        if (_staging)
+        {
+            glUnmapNamedBuffer(_staging);
+            glDeleteBuffers(1, &_staging);
+            _staging = 0;
+        }
+        _data = nullptr;
+        _capacity = 0;
+        _segmentSize = 0;
+        _used = 0;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    bool ReadbackRing::_isExpired(std::uint64_t frame) const
+    {
+        // A segment is reused frame count frames after it was filled
+        return !_data || _frame - frame >= _frameCount;
+    }
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "IReleasable.hpp"
+#include "IResource.hpp"
+#include "GpuFence.hpp"
+
+namespace bw::low_level
+{
+    class ReadbackRing;
+
+    ///
+    /// @class BufferReadback
+    /// @brief Class that reads a range of the buffer back to the CPU without stalling the pipeline
+    /// 
+    /// The range is copied on the GPU side into a persistently mapped staging buffer and the copy is fenced.
+    /// The data can be accessed after the fence is signaled, so the readback latency overlaps with the other work.
+    /// Standalone readbacks create their own staging buffer, readbacks made every frame should go through a ReadbackRing.
+    ///
+    /// @implements IReleasable
+    ///
+    class BufferReadback : public IReleasable
+    {
+    public:
+        /// @brief Creates the staging buffer and schedules the copy of the source range into it
+        /// @param sourceHandle OpenGL handle of the source buffer
+        /// @param offset Offset of the range in bytes
+        /// @param size Size of the range in bytes
+        BufferReadback(unsigned int sourceHandle, size_t offset, size_t size);
+
+        BufferReadback(const BufferReadback&) = delete;
+        BufferReadback(BufferReadback&& moved) noexcept;
+
+        ~BufferReadback();
+
+        BufferReadback& operator=(const BufferReadback&) = delete;
+        BufferReadback& operator=(BufferReadback&& moved) noexcept;
+
+        /// @brief Polls the readback without blocking
+        /// @return True if the data is ready, otherwise false
+        bool isReady() const;
+
+        /// @brief Blocks until the data is ready
+        void wait() const;
+
+        /// @brief Gets the read bytes, waits if the data is not ready yet
+        /// @return Bytes of the range
+        /// @throw std::logic_error If the ring has already reused the staging memory of the readback
+        std::span<const std::byte> getBytes();
+
+        /// @brief Check if the staging memory of the readback made through a ring has been reused
+        /// @return True if expired, always false for the standalone readbacks
+        bool isExpired() const;
+
+        /// @brief Releases the staging buffer (if owned) and the fence
+        void release() override;
+    private:
+        friend class ReadbackRing;
+
+        unsigned int _staging;
+        GpuFence _fence;
+        const std::byte* _data;
+        size_t _size;
+        const ReadbackRing* _ring;
+        std::uint64_t _frame;
+
+        BufferReadback(const ReadbackRing& ring, std::uint64_t frame, const std::byte* data, size_t size);
+    };
+
+    ///
+    /// @class AsyncReadback
+    /// @brief Typed readback of the buffer range
+    /// @tparam T Buffer data type
+    ///
+    template <typename T>
+    class AsyncReadback : public BufferReadback
+    {
+    public:
+        /// @brief Schedules the readback of the source range
+        /// @param sourceHandle OpenGL handle of the source buffer
+        /// @param offset Index of the first element
+        /// @param count Number of elements
+        AsyncReadback(unsigned int sourceHandle, size_t offset, size_t count);
+
+        /// @brief Wraps the readback of the bytes
+        /// @param readback Readback of count * sizeof(T) bytes
+        /// @param count Number of elements
+        AsyncReadback(BufferReadback&& readback, size_t count);
+
+        /// @brief Gets a copy of the read elements, waits if the data is not ready yet
+        /// @return Vector containing the read elements
+        std::vector<T> get();
+
+        /// @brief Copies the read elements to the output span, waits if the data is not ready yet
+        /// @param out Destination span, must hold at least size() elements
+        void readInto(std::span<T> out);
+
+        /// @brief Gets the number of read elements
+        /// @return Number of elements
+        size_t size() const;
+    private:
+        size_t _count;
+    };
+
+    ///
+    /// @class ReadbackRing
+    /// @brief Persistently mapped staging ring shared by the readbacks made every frame
+    /// 
+    /// The ring is split into one segment per frame in flight. Readbacks are placed into the segment of the current frame,
+    /// and nextFrame() moves to the next segment, so the staging memory is created and mapped once instead of per readback.
+    /// The data of a readback must be taken within the frame count, after that its segment is reused and the readback expires.
+    /// Readbacks that do not fit into the segment get their own staging buffer.
+    /// The ring must outlive its readbacks. Used only on the GL thread.
+    /// 
+    /// @implements IResource<unsigned int>
+    ///
+    class ReadbackRing : public IResource<unsigned int>
+    {
+    public:
+        /// @brief Default size of the staging ring in bytes
+        static constexpr size_t DefaultStagingSize = 4 * 1024 * 1024;
+
+        /// @brief Default number of frames the readbacks stay valid
+        static constexpr size_t DefaultFrameCount = 3;
+
+        /// @brief Creates and persistently maps the staging ring
+        /// @param stagingSize Size of the staging ring in bytes
+        /// @param frameCount Number of frames (and ring segments) the readbacks stay valid
+        /// @throw std::invalid_argument If the frame count is zero
+        /// @throw std::runtime_error If the staging ring cannot be mapped
+        ReadbackRing(size_t stagingSize = DefaultStagingSize, size_t frameCount = DefaultFrameCount);
+
+        ReadbackRing(const ReadbackRing&) = delete;
+        ReadbackRing& operator=(const ReadbackRing&) = delete;
+
+        ~ReadbackRing();
+
+        /// @brief Schedules the readback of the source range into the segment of the current frame
+        /// @param sourceHandle OpenGL handle of the source buffer
+        /// @param offset Offset of the range in bytes
+        /// @param size Size of the range in bytes
+        /// @return Readback valid until the ring comes back to the current segment
+        BufferReadback readBytes(unsigned int sourceHandle, size_t offset, size_t size);
+
+        /// @brief Schedules the typed readback of the source range into the segment of the current frame
+        /// @tparam T Buffer data type
+        /// @param sourceHandle OpenGL handle of the source buffer
+        /// @param offset Index of the first element
+        /// @param count Number of elements
+        /// @return Readback valid until the ring comes back to the current segment
+        template <typename T>
+        AsyncReadback<T> read(unsigned int sourceHandle, size_t offset, size_t count);
+
+        /// @brief Switches to the segment of the next frame, the readbacks made frame count frames ago expire
+        void nextFrame();
+
+        /// @brief Gets the number of frames the readbacks stay valid
+        /// @return Frame count
+        size_t getFrameCount() const;
+
+        /// @brief Gets the size of the staging ring
+        /// @return Staging size in bytes
+        size_t getStagingSize() const;
+
+        /// @brief Gets the staging buffer native handle
+        /// @return OpenGL buffer handle
+        unsigned int getNativeHandle() const override;
+
+        /// @brief Releases the staging ring, all its readbacks expire
+        void release() override;
+    private:
+        friend class BufferReadback;
+
+        unsigned int _staging;
+        std::byte* _data;
+        size_t _capacity;
+        size_t _frameCount;
+        size_t _segmentSize;
+        size_t _used;
+        std::uint64_t _frame;
+
+        bool _isExpired(std::uint64_t frame) const;
+    };
+}
+
+#include "BufferReadback.tpp"
@@ -0,0 +1,57 @@
+#ifndef BUFFERREADBACK_TPP
+#define BUFFERREADBACK_TPP
+
+#include <utility>
+#include <algorithm>
+
+namespace bw::low_level
+{
+    template <typename T>
+    AsyncReadback<T>::AsyncReadback(unsigned int sourceHandle, size_t offset, size_t count) 
+        : BufferReadback(sourceHandle, offset * sizeof(T), count * sizeof(T)), _count(count) { }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    AsyncReadback<T>::AsyncReadback(BufferReadback&& readback, size_t count) : BufferReadback(std::move(readback)), _count(count) { }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    std::vector<T> AsyncReadback<T>::get()
+    {
+        std::vector<T> container(_count);
+        readInto(container);
+        return container;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void AsyncReadback<T>::readInto(std::span<T> out)
+    {
+        auto bytes = getBytes();
+        if (bytes.empty()) return;
+
+        const T* data = reinterpret_cast<const T*>(bytes.data());
+        std::copy(data, data + std::min(_count, out.size()), out.begin());
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    size_t AsyncReadback<T>::size() const
+    {
+        return _count;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    AsyncReadback<T> ReadbackRing::read(unsigned int sourceHandle, size_t offset, size_t count)
+    {
+        return AsyncReadback<T>(readBytes(sourceHandle, offset * sizeof(T), count * sizeof(T)), count);
+    }
+}
+
+#endif
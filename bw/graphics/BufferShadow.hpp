@@ -0,0 +1,88 @@
+#pragma once
+
+#include <map>
+#include <span>
+#include <vector>
+#include "BufferSlice.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @struct ShadowStats
+    /// @brief Statistics of the uploads made from the shadow copy
+    ///
+    struct ShadowStats
+    {
+        /// @brief Number of bytes written by the updates
+        size_t bytesTouched = 0;
+        /// @brief Number of bytes sent to the GPU, including the merged gaps
+        size_t bytesUploaded = 0;
+        /// @brief Number of contiguous regions sent to the GPU
+        size_t uploadCount = 0;
+    };
+
+    ///
+    /// @class BufferShadow
+    /// @brief CPU-side copy of the buffer contents that records dirty ranges between flushes
+    /// 
+    /// Writes only change the copy and mark the range dirty. Overlapping and adjacent ranges are merged
+    /// immediately, ranges separated by a small gap are merged when the dirty regions are taken,
+    /// so many scattered updates turn into a few uploads.
+    /// 
+    /// @tparam T Buffer data type
+    ///
+    template <typename T>
+    class BufferShadow
+    {
+    public:
+        /// @brief Default maximum gap in elements between two ranges uploaded as one region
+        static constexpr size_t DefaultMergeGap = 64;
+
+        /// @brief Creates shadow copy with the current buffer contents
+        /// @param contents Current buffer contents
+        /// @param mergeGap Maximum gap in elements between two ranges uploaded as one region
+        BufferShadow(std::vector<T> contents, size_t mergeGap = DefaultMergeGap);
+
+        /// @brief Writes the values to the copy and marks the range dirty
+        /// @param offset Index of the first element
+        /// @param values New values (must fit into the copy)
+        void write(size_t offset, std::span<const T> values);
+
+        /// @brief Changes the number of elements, the new elements are not dirty
+        /// @param size New number of elements
+        void resize(size_t size);
+
+        /// @brief Marks the whole copy clean without uploading it
+        void clearDirty();
+
+        /// @brief Takes the merged dirty regions and marks the copy clean
+        /// @return Regions to upload sorted by offset
+        std::vector<BufferSlice> takeDirtyRegions();
+
+        /// @brief Check if there are ranges waiting for upload
+        /// @return True if dirty, otherwise false
+        bool isDirty() const;
+
+        /// @brief Gets the copy of the buffer contents
+        /// @return Pointer to the first element
+        const T* data() const;
+
+        /// @brief Gets the number of elements in the copy
+        /// @return Element count
+        size_t size() const;
+
+        /// @brief Gets the upload statistics
+        /// @return Statistics collected since the creation or the last reset
+        const ShadowStats& getStats() const;
+
+        /// @brief Resets the upload statistics
+        void resetStats();
+    private:
+        std::vector<T> _data;
+        std::map<size_t, size_t> _dirty;
+        size_t _mergeGap;
+        ShadowStats _stats;
+    };
+}
+
+#include "BufferShadow.tpp"
@@ -0,0 +1,133 @@
+#ifndef BUFFERSHADOW_TPP
+#define BUFFERSHADOW_TPP
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace bw::low_level
+{
+    template <typename T>
+    BufferShadow<T>::BufferShadow(std::vector<T> contents, size_t mergeGap) 
+        : _data(std::move(contents)), _mergeGap(mergeGap) { }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void BufferShadow<T>::write(size_t offset, std::span<const T> values)
+    {
+        if (values.empty()) return;
+        if (offset + values.size() > _data.size())
+            throw std::out_of_range("The values do not fit into the buffer");
+
+        std::copy(values.begin(), values.end(), _data.begin() + offset);
+        _stats.bytesTouched += values.size() * sizeof(T);
+
+        // Ranges are stored as [begin, end), overlapping and adjacent ones are merged
+        size_t begin = offset;
+        size_t end = offset + values.size();
+
+        auto it = _dirty.upper_bound(begin);
+        if (it != _dirty.begin() && std::prev(it)->second >= begin)
+            --it;
+
+        while (it != _dirty.end() && it->first <= end)
+        {
+            begin = std::min(begin, it->first);
+            end = std::max(end, it->second);
+            it = _dirty.erase(it);
+        }
+        _dirty.emplace(begin, end);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void BufferShadow<T>::resize(size_t size)
+    {
+        _data.resize(size);
+
+        // Drop the ranges that are no longer in the buffer
+        for (auto it = _dirty.lower_bound(size); it != _dirty.end(); )
+            it = _dirty.erase(it);
+        if (!_dirty.empty())
+        {
+            auto& last = *std::prev(_dirty.end());
+            last.second = std::min(last.second, size);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void BufferShadow<T>::clearDirty()
+    {
+        _dirty.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    std::vector<BufferSlice> BufferShadow<T>::takeDirtyRegions()
+    {
+        std::vector<BufferSlice> regions;
+        for (auto& [begin, end] : _dirty)
+        {
+            // Uploading a small clean gap is cheaper than one more driver call
+            if (!regions.empty() && begin - regions.back().end() <= _mergeGap)
+                regions.back().count = end - regions.back().offset;
+            else
+                regions.emplace_back(begin, end - begin);
+        }
+        _dirty.clear();
+
+        for (auto& region : regions)
+        {
+            _stats.bytesUploaded += region.count * sizeof(T);
+        }
+        _stats.uploadCount += regions.size();
+        return regions;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    bool BufferShadow<T>::isDirty() const
+    {
+        return !_dirty.empty();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    const T* BufferShadow<T>::data() const
+    {
+        return _data.data();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    size_t BufferShadow<T>::size() const
+    {
+        return _data.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    const ShadowStats& BufferShadow<T>::getStats() const
+    {
+        return _stats;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void BufferShadow<T>::resetStats()
+    {
+        _stats = ShadowStats();
+    }
+}
+
+#endif
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+
+namespace bw::low_level
+{
+    ///
+    /// @struct BufferSlice
+    /// @brief View of the continuous range of elements inside a shared buffer
+    ///
+    struct BufferSlice
+    {
+        /// @brief Index of the first element
+        size_t offset;
+        /// @brief Element count
+        size_t count;
+
+        BufferSlice(size_t offset, size_t count) : offset(offset), count(count) { }
+        BufferSlice() : BufferSlice(0, 0) { }
+
+        /// @brief Gets the index following the last element of the slice
+        /// @return End index
+        size_t end() const { return offset + count; }
+
+        /// @brief Check if the slice has no elements
+        /// @return True if empty, otherwise false
+        bool empty() const { return count == 0; }
+
+        bool operator==(const BufferSlice& other) const = default;
+    };
+}
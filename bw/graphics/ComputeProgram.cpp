@@ -0,0 +1,87 @@
+#include <stdexcept>
+#include <glad/glad.h>
+#include "ComputeProgram.hpp"
+
+namespace bw::low_level
+{
+    GLbitfield cp_barriersToGLBitfield(unsigned int barriers)
+    {
+        GLbitfield bits = 0;
+
+        if (barriers & VertexAttribBarrier)      bits |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
+        if (barriers & ElementArrayBarrier)      bits |= GL_ELEMENT_ARRAY_BARRIER_BIT;
+        if (barriers & UniformBarrier)           bits |= GL_UNIFORM_BARRIER_BIT;
+        if (barriers & CommandBarrier)           bits |= GL_COMMAND_BARRIER_BIT;
+        if (barriers & ShaderStorageBarrier)     bits |= GL_SHADER_STORAGE_BARRIER_BIT;
+        if (barriers & BufferUpdateBarrier)      bits |= GL_BUFFER_UPDATE_BARRIER_BIT;
+        if (barriers & ShaderImageAccessBarrier) bits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+
+        return bits;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void memoryBarrier(unsigned int barriers)
+    {
+        GLbitfield bits = cp_barriersToGLBitfield(barriers);
+        if (bits != 0)
+            glMemoryBarrier(bits);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    ComputeProgram::ComputeProgram(Shader& shader)
+    {
+        if (shader.getType() != Shader::Compute)
+            throw std::invalid_argument("Compute program requires a compute shader");
+
+        attach(shader);
+        link();
+
+        int status;
+        glGetProgramiv(getNativeHandle(), GL_LINK_STATUS, &status);
+        if (status != GL_TRUE)
+            throw std::runtime_error("Failed to link the compute program");
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void ComputeProgram::dispatch(unsigned int groupsX, unsigned int groupsY, unsigned int groupsZ) const
+    {
+        use();
+        glDispatchCompute(groupsX, groupsY, groupsZ);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void ComputeProgram::dispatchIndirect(const DispatchIndirectBuffer& commands, size_t index) const
+    {
+        if (index >= commands.size())
+            throw std::out_of_range("Dispatch command index is out of the buffer");
+
+        use();
+        commands.bind();
+        glDispatchComputeIndirect(static_cast<GLintptr>(index * sizeof(DispatchIndirectCommand)));
+        glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    Vec3<int> ComputeProgram::getWorkGroupSize() const
+    {
+        int size[3] = { 0, 0, 0 };
+        glGetProgramiv(getNativeHandle(), GL_COMPUTE_WORK_GROUP_SIZE, size);
+
+        return { size[0], size[1], size[2] };
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    unsigned int ComputeProgram::groupCount(size_t items, unsigned int groupSize)
+    {
+        if (groupSize == 0)
+            throw std::invalid_argument("Work group size must not be zero");
+
+        return static_cast<unsigned int>((items + groupSize - 1) / groupSize);
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include "ShaderProgram.hpp"
+#include "TypedBuffer.hpp"
+#include "math/Vec3.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @struct DispatchIndirectCommand
+    /// @brief Number of work groups of one dispatch read by the GPU from the dispatch indirect buffer
+    ///
+    struct DispatchIndirectCommand
+    {
+        unsigned int groupsX;
+        unsigned int groupsY;
+        unsigned int groupsZ;
+    };
+
+    using DispatchIndirectBuffer = TypedBuffer<DispatchIndirectCommand, DispatchIndirectTarget>;
+
+    ///
+    /// @enum BarrierBit
+    /// @brief Ways the data written by shaders is read afterwards. Combine them with the `|` operator
+    ///
+    enum BarrierBit
+    {
+        VertexAttribBarrier = 1 << 0,      // Vertex buffers read by draws
+        ElementArrayBarrier = 1 << 1,      // Element buffers read by draws
+        UniformBarrier = 1 << 2,           // Uniform buffers
+        CommandBarrier = 1 << 3,           // Indirect draw and dispatch commands
+        ShaderStorageBarrier = 1 << 4,     // Shader storage buffers read by other shaders
+        BufferUpdateBarrier = 1 << 5,      // Buffer reads, writes and copies from the CPU side
+        ShaderImageAccessBarrier = 1 << 6, // Images loaded and stored by other shaders
+        AllBarriers = (1 << 7) - 1
+    };
+
+    ///
+    /// @brief Makes the writes of the previous shader invocations to buffers and images visible to the following operations.
+    /// Needed between a dispatch and anything that reads its results
+    /// @param barriers Combination of BarrierBit values
+    ///
+    void memoryBarrier(unsigned int barriers);
+
+    ///
+    /// @class ComputeProgram
+    /// @brief Shader program made of a single compute shader that runs on the GPU outside the draws,
+    /// e.g. to simulate particles or cull objects straight in the storage, vertex or indirect buffers
+    /// @implements IReleasable
+    ///
+    class ComputeProgram : public ShaderProgram
+    {
+    public:
+        /// @brief Creates the program and links the compute shader into it
+        /// @param shader Compiled compute shader
+        /// @throw std::invalid_argument If the shader is not a compute shader
+        /// @throw std::runtime_error If the program fails to link
+        ComputeProgram(Shader& shader);
+
+        ComputeProgram(ComputeProgram&& moved) = default;
+        ComputeProgram& operator=(ComputeProgram&& moved) = default;
+
+        /// @brief Runs the program for the grid of work groups
+        /// @param groupsX Number of work groups in X
+        /// @param groupsY Number of work groups in Y
+        /// @param groupsZ Number of work groups in Z
+        void dispatch(unsigned int groupsX, unsigned int groupsY = 1, unsigned int groupsZ = 1) const;
+
+        /// @brief Runs the program for the grid of work groups read from the buffer by the GPU
+        /// @param commands Buffer of the dispatch commands
+        /// @param index Index of the command in the buffer
+        void dispatchIndirect(const DispatchIndirectBuffer& commands, size_t index = 0) const;
+
+        /// @brief Gets the work group size declared by the shader (local_size_x/y/z)
+        /// @return Work group size
+        Vec3<int> getWorkGroupSize() const;
+
+        /// @brief Calculates the number of work groups that covers all items
+        /// @param items Number of items
+        /// @param groupSize Number of items in one work group
+        /// @return Number of work groups
+        static unsigned int groupCount(size_t items, unsigned int groupSize);
+    };
+}
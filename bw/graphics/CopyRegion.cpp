@@ -0,0 +1,68 @@
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include "CopyRegion.hpp"
+
+namespace bw::low_level
+{
+    bool cr_overlaps(const CopyRegion& region)
+    {
+        return region.srcOffset < region.dstOffset + region.count && region.dstOffset < region.srcOffset + region.count;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    size_t coalesceCopyRegions(std::span<CopyRegion> regions, size_t srcSize, size_t dstSize, bool sameBuffer)
+    {
+        for (auto& region : regions)
+        {
+            if (region.srcOffset + region.count > srcSize || region.dstOffset + region.count > dstSize)
+                throw std::out_of_range("The copy region is out of the buffer");
+
+            // The driver cannot copy between overlapping ranges of one buffer
+            if (sameBuffer && region.count > 0 && cr_overlaps(region))
+                throw std::invalid_argument("The source and destination ranges overlap");
+        }
+
+        auto end = std::remove_if(regions.begin(), regions.end(), [](const CopyRegion& region) { return region.count == 0; });
+        std::sort(regions.begin(), end, [](const CopyRegion& a, const CopyRegion& b) { return a.dstOffset < b.dstOffset; });
+
+        for (auto it = regions.begin(); it != end; ++it)
+        {
+            if (it != regions.begin() && it->dstOffset < std::prev(it)->dstOffset + std::prev(it)->count)
+                throw std::invalid_argument("The destination ranges overlap");
+        }
+
+        // The copies run in the order of the destinations, so within one buffer no region may read
+        // what another one writes, otherwise the result would depend on that order
+        if (sameBuffer)
+        {
+            for (auto it = regions.begin(); it != end; ++it)
+            {
+                auto written = std::upper_bound(regions.begin(), end, it->srcOffset, 
+                    [](size_t offset, const CopyRegion& region) { return offset < region.dstOffset + region.count; });
+
+                if (written != end && written->dstOffset < it->srcOffset + it->count)
+                    throw std::invalid_argument("The copy region reads the range written by another region");
+            }
+        }
+
+        size_t count = 0;
+        for (auto it = regions.begin(); it != end; ++it)
+        {
+            if (count > 0)
+            {
+                CopyRegion& last = regions[count - 1];
+                CopyRegion merged(last.srcOffset, last.dstOffset, last.count + it->count);
+                if (it->dstOffset == last.dstOffset + last.count && it->srcOffset == last.srcOffset + last.count &&
+                    !(sameBuffer && cr_overlaps(merged)))
+                {
+                    last = merged;
+                    continue;
+                }
+            }
+            regions[count++] = *it;
+        }
+        return count;
+    }
+}
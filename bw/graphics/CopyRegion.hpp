@@ -0,0 +1,39 @@
+#pragma once
+
+#include <span>
+#include <cstddef>
+
+namespace bw::low_level
+{
+    ///
+    /// @struct CopyRegion
+    /// @brief Range of elements copied from one buffer to another
+    ///
+    struct CopyRegion
+    {
+        /// @brief Index of the first element in the source buffer
+        size_t srcOffset;
+        /// @brief Index of the first element in the destination buffer
+        size_t dstOffset;
+        /// @brief Element count
+        size_t count;
+
+        CopyRegion(size_t srcOffset, size_t dstOffset, size_t count) : srcOffset(srcOffset), dstOffset(dstOffset), count(count) { }
+        CopyRegion() : CopyRegion(0, 0, 0) { }
+
+        bool operator==(const CopyRegion& other) const = default;
+    };
+
+    /// @brief Validates the copy regions, then sorts and merges them in place.
+    /// Regions that continue each other in both buffers become one region, empty regions are removed
+    /// @param regions Regions to validate and merge
+    /// @param srcSize Number of elements in the source buffer
+    /// @param dstSize Number of elements in the destination buffer
+    /// @param sameBuffer True if the source and the destination is the same buffer.
+    /// In this case regions must not read the ranges written by any region
+    /// @return Number of regions at the beginning of the span after the merge
+    /// @throw std::out_of_range if a region is out of one of the buffers
+    /// @throw std::invalid_argument if the destination ranges overlap each other, or in the same buffer
+    /// if a source range overlaps any destination range
+    size_t coalesceCopyRegions(std::span<CopyRegion> regions, size_t srcSize, size_t dstSize, bool sameBuffer);
+}
@@ -10,104 +10,196 @@ namespace bw::low_level
         {
             case MapAccess::ReadOnly:  return GL_READ_ONLY;
             case MapAccess::WriteOnly: return GL_WRITE_ONLY;
-            default:                   return GL_NONE;
+            default:                   return GL_READ_WRITE;
         }
     }
 
 	////////////////////////////////////////////////////////////
 
-    EBMapContext::EBMapContext(ElementBuffer& buffer) : _buffer(&buffer) { }
+    GLbitfield eb_mapRangeToGLbitfield(MapAccess access, unsigned int flags)
+    {
+        GLbitfield bits = 0;
+
+        switch(access)
+        {
+            case MapAccess::ReadOnly:  bits = GL_MAP_READ_BIT; break;
+            case MapAccess::WriteOnly: bits = GL_MAP_WRITE_BIT; break;
+            default:                   bits = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT; break;
+        }
+
+        if(flags & MapFlags::InvalidateRange)  bits |= GL_MAP_INVALIDATE_RANGE_BIT;
+        if(flags & MapFlags::InvalidateBuffer) bits |= GL_MAP_INVALIDATE_BUFFER_BIT;
+        if(flags & MapFlags::Unsynchronized)   bits |= GL_MAP_UNSYNCHRONIZED_BIT;
+        if(flags & MapFlags::FlushExplicit)    bits |= GL_MAP_FLUSH_EXPLICIT_BIT;
+
+        return bits;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    template <typename TIndex>
+    BasicEBMapContext<TIndex>::BasicEBMapContext(BasicElementBuffer<TIndex>& buffer) : _buffer(&buffer), _data(nullptr), _mapped(false), _count(0) { }
     
 	////////////////////////////////////////////////////////////
 
-    EBMapContext::EBMapContext(EBMapContext&& moved)
+    template <typename TIndex>
+    BasicEBMapContext<TIndex>::BasicEBMapContext(BasicEBMapContext&& moved)
     {   
         this->_buffer = moved._buffer;
         this->_data = moved._data;
+        this->_mapped = moved._mapped;
+        this->_count = moved._count;
 
         moved._buffer = nullptr;
         moved._data = nullptr;
+        moved._mapped = false;
+        moved._count = 0;
     }
 
 	////////////////////////////////////////////////////////////
        
-    EBMapContext::~EBMapContext()
+    template <typename TIndex>
+    BasicEBMapContext<TIndex>::~BasicEBMapContext()
     {
         unmap();
     }
     
 	////////////////////////////////////////////////////////////
 
-    EBMapContext& EBMapContext::operator=(EBMapContext&& moved)
+    template <typename TIndex>
+    BasicEBMapContext<TIndex>& BasicEBMapContext<TIndex>::operator=(BasicEBMapContext&& moved)
     {
         unmap();
 
         this->_buffer = moved._buffer;
         this->_data = moved._data;
+        this->_mapped = moved._mapped;
+        this->_count = moved._count;
 
         moved._buffer = nullptr;
         moved._data = nullptr;
+        moved._mapped = false;
+        moved._count = 0;
 
         return *this;
     }
     
 	////////////////////////////////////////////////////////////
 
-    size_t& EBMapContext::operator[](int index)
+    template <typename TIndex>
+    TIndex& BasicEBMapContext<TIndex>::operator[](int index)
     {
         return *(_data + index);
     }
     
 	////////////////////////////////////////////////////////////
 
-    const size_t& EBMapContext::operator[](int index) const
+    template <typename TIndex>
+    const TIndex& BasicEBMapContext<TIndex>::operator[](int index) const
     {
         return *(_data + index);
     }
     
 	////////////////////////////////////////////////////////////
 
-    void EBMapContext::map(MapAccess access)
+    template <typename TIndex>
+    void BasicEBMapContext<TIndex>::map(MapAccess access)
+    {
+        if(!_mapped)
+        {
+            _data = static_cast<TIndex*>(glMapNamedBuffer(_buffer->getNativeHandle(), eb_mapAccessToGLenum(access)));
+            _mapped = _data != nullptr;
+            _count = _buffer->size();
+        }
+    }
+
+	////////////////////////////////////////////////////////////
+
+    template <typename TIndex>
+    void BasicEBMapContext<TIndex>::mapRange(size_t offset, size_t count, MapAccess access, unsigned int flags)
+    {
+        if(!_mapped)
+        {
+            _data = static_cast<TIndex*>(glMapNamedBufferRange(_buffer->getNativeHandle(), offset * sizeof(TIndex), 
+                                                               count * sizeof(TIndex), eb_mapRangeToGLbitfield(access, flags)));
+            _mapped = _data != nullptr;
+            _count = count;
+        }
+    }
+
+	////////////////////////////////////////////////////////////
+
+    template <typename TIndex>
+    void BasicEBMapContext<TIndex>::flushRange(size_t offset, size_t count)
     {
-        if(!isMapped())
-            _data = static_cast<size_t*>(glMapNamedBuffer(_buffer->getNativeHandle(), eb_mapAccessToGLenum(access)));
+        if(_mapped)
+            glFlushMappedNamedBufferRange(_buffer->getNativeHandle(), offset * sizeof(TIndex), count * sizeof(TIndex));
     }
     
 	////////////////////////////////////////////////////////////
 
-    void EBMapContext::unmap()
+    template <typename TIndex>
+    void BasicEBMapContext<TIndex>::unmap()
     {
-        if(isMapped())
+        if(_mapped)
+        {
             glUnmapNamedBuffer(_buffer->getNativeHandle());
+            _data = nullptr;
+            _mapped = false;
+            _count = 0;
+        }
     }
     
 	////////////////////////////////////////////////////////////
 
-    bool EBMapContext::isMapped() const
+    template <typename TIndex>
+    bool BasicEBMapContext<TIndex>::isMapped() const
     {
-        int mapped;
-
-        glGetNamedBufferParameteriv(_buffer->getNativeHandle(), GL_BUFFER_MAPPED, &mapped);
-    
-        return mapped;
+        return _mapped;
     }
     
 	////////////////////////////////////////////////////////////
 
-    size_t& EBMapContext::get(int index)
+    template <typename TIndex>
+    TIndex& BasicEBMapContext<TIndex>::get(int index)
     {
         return (*this)[index];
     }
 
 	////////////////////////////////////////////////////////////
 
-    std::optional<size_t*> EBMapContext::tryGet(int index)
+    template <typename TIndex>
+    std::optional<TIndex*> BasicEBMapContext<TIndex>::tryGet(int index)
     {
         if(!_data) return std::nullopt;
 
-        int n = _buffer->size();
-        if(index < 0 || index >= n) return std::nullopt;
+        if(index < 0 || static_cast<size_t>(index) >= _count) return std::nullopt;
 
         return _data + index;
     }
+
+	////////////////////////////////////////////////////////////
+
+    template <typename TIndex>
+    std::span<TIndex> BasicEBMapContext<TIndex>::span()
+    {
+        if(!_mapped) return {};
+
+        return { _data, _count };
+    }
+
+	////////////////////////////////////////////////////////////
+
+    template <typename TIndex>
+    std::span<const TIndex> BasicEBMapContext<TIndex>::span() const
+    {
+        if(!_mapped) return {};
+
+        return { _data, _count };
+    }
+
+	////////////////////////////////////////////////////////////
+
+    template class BasicEBMapContext<unsigned short>;
+    template class BasicEBMapContext<unsigned int>;
 }
@@ -4,50 +4,80 @@
 
 namespace bw::low_level
 {
-    class ElementBuffer;
+    template <typename TIndex>
+    class BasicElementBuffer;
 
     ///
-    /// @class EBMapContext
+    /// @class BasicEBMapContext
     /// @brief Class for working with mapping element buffers
-    /// @implements IBufferMapContext<size_t>
+    /// @implements IBufferMapContext<TIndex>
+    /// @tparam TIndex Index type of the element buffer
     ///
-    class EBMapContext : public IBufferMapContext<size_t>
+    template <typename TIndex>
+    class BasicEBMapContext : public IBufferMapContext<TIndex>
     {
     public:
-        EBMapContext(ElementBuffer& buffer);
+        BasicEBMapContext(BasicElementBuffer<TIndex>& buffer);
 
-        EBMapContext(const EBMapContext&) = delete;
-        EBMapContext(EBMapContext&& moved);
+        BasicEBMapContext(const BasicEBMapContext&) = delete;
+        BasicEBMapContext(BasicEBMapContext&& moved);
 
-        ~EBMapContext();
+        ~BasicEBMapContext();
 
-        EBMapContext& operator=(const EBMapContext&) = delete;
-        EBMapContext& operator=(EBMapContext&& moved);
+        BasicEBMapContext& operator=(const BasicEBMapContext&) = delete;
+        BasicEBMapContext& operator=(BasicEBMapContext&& moved);
 
-        size_t& operator[](int index);
-        const size_t& operator[](int index) const;
+        TIndex& operator[](int index);
+        const TIndex& operator[](int index) const;
 
         /// @brief Maps the buffer to make it accessible if it not mapped yet
         void map(MapAccess access) override;
 
+        /// @brief Maps the range of the buffer to make it accessible if it not mapped yet.
+        /// Indices of the context become relative to the beginning of the range
+        /// @param offset Index of the first mapped index
+        /// @param count Number of mapped indices
+        /// @param access Access mode
+        /// @param flags Combination of MapFlags
+        void mapRange(size_t offset, size_t count, MapAccess access, unsigned int flags = 0) override;
+
+        /// @brief Flushes the modified part of the mapped range. Requires MapFlags::FlushExplicit
+        /// @param offset Index of the first modified index relative to the mapped range
+        /// @param count Number of modified indices
+        void flushRange(size_t offset, size_t count) override;
+
         /// @brief Unmaps the buffer if it mapped
         void unmap() override;
 
-        /// @brief Get map status
+        /// @brief Get map status. The status is tracked by the context and does not query the driver
         /// @return True if mapped, otherwise false
         bool isMapped() const override;
 
         /// @brief Get the index by the index. Only work with the enabled mapping
         /// @param index The element index
-        /// @return Correct or incorrect buffer size_t
-        size_t& get(int index) override;
+        /// @return Correct or incorrect buffer index
+        TIndex& get(int index) override;
 
         /// @brief Safely get the index by the index. Only work with the enabled mapping
         /// @param index The element index
         /// @return Correct buffer element or none
-        std::optional<size_t*> tryGet(int index) override;
+        std::optional<TIndex*> tryGet(int index) override;
+
+        /// @brief Get the mapped indices as a contiguous span. Only work with the enabled mapping
+        /// @return Mapped indices (empty if the buffer is not mapped)
+        std::span<TIndex> span() override;
+
+        /// @brief Get the mapped indices as a contiguous span. Only work with the enabled mapping
+        /// @return Mapped indices (empty if the buffer is not mapped)
+        std::span<const TIndex> span() const override;
     private:
-        ElementBuffer* _buffer;
-        size_t* _data;
+        BasicElementBuffer<TIndex>* _buffer;
+        TIndex* _data;
+        bool _mapped;
+        size_t _count;
     };
+
+    using EBMapContext16 = BasicEBMapContext<unsigned short>;
+    using EBMapContext32 = BasicEBMapContext<unsigned int>;
+    using EBMapContext = EBMapContext32;
 }
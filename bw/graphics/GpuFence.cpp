@@ -0,0 +1,106 @@
+#include <cstdint>
+#include <algorithm>
+#include <glad/glad.h>
+#include "GpuFence.hpp"
+
+namespace bw::low_level
+{
+    // Timeout of a single wait iteration in the blocking wait (1 second)
+    const GLuint64 gf_waitStep = 1000000000;
+
+	////////////////////////////////////////////////////////////
+
+    GpuFence::GpuFence() : _sync(nullptr) { }
+
+	////////////////////////////////////////////////////////////
+
+    GpuFence::GpuFence(GpuFence&& moved) noexcept : _sync(moved._sync)
+    {
+        moved._sync = nullptr;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    GpuFence::~GpuFence()
+    {
+        release();
+    }
+
+	////////////////////////////////////////////////////////////
+
+    GpuFence& GpuFence::operator=(GpuFence&& moved) noexcept
+    {
+        if (this != &moved)
+        {
+            release();
+
+            _sync = moved._sync;
+            moved._sync = nullptr;
+        }
+        return *this;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void GpuFence::signal()
+    {
+        release();
+        _sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+	////////////////////////////////////////////////////////////
+
+    bool GpuFence::isSignaled() const
+    {
+        if (!_sync) return true;
+
+        GLenum result = glClientWaitSync(static_cast<GLsync>(_sync), GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    bool GpuFence::wait() const
+    {
+        if (!_sync) return true;
+
+        GLenum result;
+        do 
+        {
+            result = glClientWaitSync(static_cast<GLsync>(_sync), GL_SYNC_FLUSH_COMMANDS_BIT, gf_waitStep);
+        } 
+        while (result == GL_TIMEOUT_EXPIRED);
+
+        return result != GL_WAIT_FAILED;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    bool GpuFence::wait(std::chrono::nanoseconds timeout) const
+    {
+        if (!_sync) return true;
+
+        // A negative timeout means not to wait, it must not wrap around to a huge unsigned value
+        GLuint64 nanoseconds = static_cast<GLuint64>(std::max<std::int64_t>(0, timeout.count()));
+        GLenum result = glClientWaitSync(static_cast<GLsync>(_sync), GL_SYNC_FLUSH_COMMANDS_BIT, nanoseconds);
+        return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void* GpuFence::getNativeHandle() const
+    {
+        return _sync;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void GpuFence::release()
+    {
+        if (_sync)
+        {
+            glDeleteSync(static_cast<GLsync>(_sync));
+            _sync = nullptr;
+        }
+    }
+}
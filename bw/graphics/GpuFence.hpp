@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include "IResource.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @class GpuFence
+    /// @brief Class that wraps the functionality of sync objects in the OpenGL API
+    /// 
+    /// The fence is inserted into the command stream by signal() and becomes signaled when the GPU
+    /// completes all commands issued before it. It is used to find out when the GPU stops reading
+    /// the memory so it can be overwritten without a full glFinish.
+    ///
+    /// @implements IResource<void*>
+    ///
+    class GpuFence : public IResource<void*>
+    {
+    public:
+        /// @brief Creates an empty fence that is considered signaled
+        GpuFence();
+
+        GpuFence(const GpuFence&) = delete;
+        GpuFence(GpuFence&& moved) noexcept;
+
+        ~GpuFence();
+
+        GpuFence& operator=(const GpuFence&) = delete;
+        GpuFence& operator=(GpuFence&& moved) noexcept;
+
+        /// @brief Inserts the fence after all commands issued so far, replacing the previous one
+        void signal();
+
+        /// @brief Polls the fence without blocking
+        /// @return True if the GPU has passed the fence (or the fence is empty), otherwise false
+        bool isSignaled() const;
+
+        /// @brief Blocks until the GPU passes the fence
+        /// @return True if signaled, false if the wait failed
+        bool wait() const;
+
+        /// @brief Blocks until the GPU passes the fence or the timeout expires
+        /// @param timeout Maximum time to wait
+        /// @return True if signaled, false if the timeout expired or the wait failed
+        bool wait(std::chrono::nanoseconds timeout) const;
+
+        /// @brief Gets fence native handle
+        /// @return OpenGL sync object (nullptr if the fence is empty)
+        void* getNativeHandle() const override;
+
+        /// @brief Deletes the sync object
+        void release() override;
+    private:
+        void* _sync;
+    };
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <span>
+#include "IBufferStorage.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @class GpuVector
+    /// @brief Dynamic array on top of the buffer storage that separates the number of used elements
+    /// from the allocated capacity and grows the storage geometrically
+    /// 
+    /// Appending to the vector reallocates the storage only when the capacity is exhausted,
+    /// so the amortized cost of the append does not depend on the vector size.
+    /// The vector does not own the storage, it must outlive the vector.
+    /// 
+    /// @tparam T Buffer data type
+    ///
+    template <typename T>
+    class GpuVector
+    {
+    public:
+        /// @brief Default factor of the capacity growth
+        static constexpr float DefaultGrowthFactor = 1.5f;
+
+        /// @brief Minimal number of elements allocated by the first growth
+        static constexpr size_t MinCapacity = 16;
+
+        /// @brief Creates empty vector on top of the storage
+        /// @param storage Buffer storage that holds the elements
+        /// @param growthFactor Factor of the capacity growth (must be greater than 1)
+        /// @throw std::invalid_argument If the storage is a stream ring
+        GpuVector(IBufferStorage<T>& storage, float growthFactor = DefaultGrowthFactor);
+
+        /// @brief Appends the element to the end of the vector
+        /// @param value Element to append
+        void pushBack(const T& value);
+
+        /// @brief Appends the elements to the end of the vector
+        /// @param values Elements to append
+        void append(std::span<const T> values);
+
+        /// @brief Changes the number of used elements. New elements are not initialized
+        /// @param size New number of elements
+        void resize(size_t size);
+
+        /// @brief Grows the capacity of the storage to hold at least the specified number of elements
+        /// @param capacity Number of elements to reserve
+        void reserve(size_t capacity);
+
+        /// @brief Removes all elements without releasing the storage memory
+        void clear();
+
+        /// @brief Gets the number of used elements
+        /// @return Number of elements
+        size_t size() const;
+
+        /// @brief Gets the number of elements the storage can hold without reallocation
+        /// @return Capacity in number of elements
+        size_t capacity() const;
+
+        /// @brief Check if the vector has no elements
+        /// @return True if empty, otherwise false
+        bool empty() const;
+
+        /// @brief Gets the storage of the vector
+        /// @return Buffer storage
+        IBufferStorage<T>& getStorage() const;
+    private:
+        IBufferStorage<T>* _storage;
+        size_t _size;
+        float _growthFactor;
+
+        void _grow(size_t required);
+    };
+}
+
+#include "GpuVector.tpp"
@@ -0,0 +1,107 @@
+#ifndef GPUVECTOR_TPP
+#define GPUVECTOR_TPP
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace bw::low_level
+{
+    template <typename T>
+    GpuVector<T>::GpuVector(IBufferStorage<T>& storage, float growthFactor) 
+        : _storage(&storage), _size(0), _growthFactor(std::max(growthFactor, 1.0f))
+    {
+        if (storage.isStreaming())
+            throw std::invalid_argument("Stream rings address the current frame and cannot back a vector");
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void GpuVector<T>::pushBack(const T& value)
+    {
+        append({ &value, 1 });
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void GpuVector<T>::append(std::span<const T> values)
+    {
+        if (values.empty()) return;
+
+        _grow(_size + values.size());
+        _storage->update(_size, values);
+        _size += values.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void GpuVector<T>::resize(size_t size)
+    {
+        _grow(size);
+        _size = size;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void GpuVector<T>::reserve(size_t capacity)
+    {
+        _storage->reserve(capacity);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void GpuVector<T>::clear()
+    {
+        _size = 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    size_t GpuVector<T>::size() const
+    {
+        return _size;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    size_t GpuVector<T>::capacity() const
+    {
+        return _storage->size();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    bool GpuVector<T>::empty() const
+    {
+        return _size == 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    IBufferStorage<T>& GpuVector<T>::getStorage() const
+    {
+        return *_storage;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void GpuVector<T>::_grow(size_t required)
+    {
+        size_t currentCapacity = capacity();
+        if (required <= currentCapacity) return;
+
+        size_t grown = static_cast<size_t>(currentCapacity * _growthFactor);
+        _storage->reserve(std::max({ required, grown, MinCapacity }));
+    }
+}
+
+#endif
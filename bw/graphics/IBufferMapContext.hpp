@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <optional>
+#include <span>
 
 namespace bw::low_level
 {
@@ -16,6 +18,18 @@ namespace bw::low_level
         ReadAndWrite  
     };
 
+    ///
+    /// @enum MapFlags
+    /// @brief Additional flags of the range mapping, can be combined with bitwise or
+    ///
+    enum MapFlags
+    {
+        InvalidateRange  = 1 << 0, // The previous contents of the mapped range may be discarded
+        InvalidateBuffer = 1 << 1, // The previous contents of the whole buffer may be discarded
+        Unsynchronized   = 1 << 2, // The driver does not wait for the pending operations on the buffer
+        FlushExplicit    = 1 << 3  // The modified parts of the range are flushed with flushRange
+    };
+
     ///
     /// @interface IBufferMapContext
     /// @brief Interface that provides access to functions for working with buffer map
@@ -29,6 +43,18 @@ namespace bw::low_level
         /// @brief Maps the buffer to make it accessible
         virtual void map(MapAccess access) = 0;
 
+        /// @brief Maps the range of the buffer to make it accessible
+        /// @param offset Index of the first mapped element
+        /// @param count Number of mapped elements
+        /// @param access Access mode
+        /// @param flags Combination of MapFlags
+        virtual void mapRange(size_t offset, size_t count, MapAccess access, unsigned int flags = 0) = 0;
+
+        /// @brief Flushes the modified part of the mapped range. Requires MapFlags::FlushExplicit
+        /// @param offset Index of the first modified element relative to the mapped range
+        /// @param count Number of modified elements
+        virtual void flushRange(size_t offset, size_t count) = 0;
+
         /// @brief Unmaps the buffer
         virtual void unmap() = 0;
 
@@ -45,5 +71,26 @@ namespace bw::low_level
         /// @param index The element's index
         /// @return Correct buffer element or none
         virtual std::optional<T*> tryGet(int index) = 0;
+
+        /// @brief Get the mapped elements as a contiguous span. Only work with the enabled mapping
+        /// @return Mapped elements (empty if the buffer is not mapped)
+        virtual std::span<T> span() = 0;
+
+        /// @brief Get the mapped elements as a contiguous span. Only work with the enabled mapping
+        /// @return Mapped elements (empty if the buffer is not mapped)
+        virtual std::span<const T> span() const = 0;
+
+        /// @brief Get the number of mapped elements
+        /// @return Element count (0 if the buffer is not mapped)
+        size_t size() const { return span().size(); }
+
+        /// @brief Get the pointer to the first mapped element.
+        /// Together with end() makes the context a contiguous range for std::ranges algorithms
+        T* begin() { return span().data(); }
+        const T* begin() const { return span().data(); }
+
+        /// @brief Get the pointer past the last mapped element
+        T* end() { return begin() + size(); }
+        const T* end() const { return begin() + size(); }
     };
 }
@@ -1,8 +1,13 @@
 #pragma once
 
 #include <span>
+#include <array>
 #include <vector>
+#include <ranges>
+#include <algorithm>
+#include <type_traits>
 #include "IBufferMapContext.hpp"
+#include "CopyRegion.hpp"
 
 namespace bw::low_level
 {
@@ -26,6 +31,9 @@ namespace bw::low_level
     class IBufferStorage
     {
     public:
+        /// @brief Number of elements in the stack buffer used to upload non-contiguous ranges
+        static constexpr size_t UploadChunkSize = std::max<size_t>(4096 / sizeof(T), 1);
+
         virtual ~IBufferStorage() = default;
     
         ///
@@ -38,7 +46,33 @@ namespace bw::low_level
         /// @brief Update buffer contents with new data
         /// @param data Span containing the new data to update the buffer with
         ///
-        virtual void update(std::span<T> data) = 0;
+        virtual void update(std::span<const T> data) = 0;
+
+        ///
+        /// @brief Update buffer contents with new data starting from the offset
+        /// @param offset Offset from the beginning of the buffer in number of elements
+        /// @param data Span containing the new data to update the buffer with
+        ///
+        virtual void update(size_t offset, std::span<const T> data) = 0;
+
+        ///
+        /// @brief Update buffer contents with the elements of the range starting from the offset.
+        /// Contiguous ranges are uploaded directly, other ranges (views, generators) are uploaded
+        /// in chunks through a stack buffer, so the upload does not allocate
+        /// @param offset Offset from the beginning of the buffer in number of elements
+        /// @param range Range of the new elements
+        ///
+        template <std::ranges::input_range TRange>
+        void updateRange(size_t offset, TRange&& range);
+
+        ///
+        /// @brief Update buffer contents with the generated elements
+        /// @param offset Offset from the beginning of the buffer in number of elements
+        /// @param count Number of elements to generate
+        /// @param generator Function that returns the element by its index in the generated sequence
+        ///
+        template <typename TGenerator>
+        void generate(size_t offset, size_t count, TGenerator generator);
         
         ///
         /// @brief Copy contents of this buffer to another buffer
@@ -46,11 +80,25 @@ namespace bw::low_level
         ///
         virtual void copyTo(IBufferStorage& buffer) const = 0;
 
+        ///
+        /// @brief Copy the regions of this buffer to another buffer (or to another place of this buffer)
+        /// @param buffer Destination buffer
+        /// @param regions Regions in number of elements, they are validated, sorted and merged in place
+        ///
+        virtual void copyRanges(IBufferStorage& buffer, std::span<CopyRegion> regions) const = 0;
+
         ///
         /// @brief Get a copy of the buffer data
         /// @return Vector containing a copy of all buffer data
         ///
         virtual std::vector<T> data() const = 0;
+
+        ///
+        /// @brief Read buffer data into the caller's memory without allocating
+        /// @param out Destination span, its size defines the number of elements to read
+        /// @param offset Offset from the beginning of the buffer in number of elements
+        ///
+        virtual void readInto(std::span<T> out, size_t offset = 0) const = 0;
         
         ///
         /// @brief Get the current max number of elements buffer can store
@@ -63,5 +111,54 @@ namespace bw::low_level
         /// @return Maximum number of elements the buffer can hold without reallocation
         ///
         virtual size_t capacity() const = 0;
+
+        ///
+        /// @brief Check if the storage is a stream ring, whose update offsets are relative to the current frame
+        /// and whose handle changes on reserve(). Containers addressing the whole storage reject such storages
+        /// @return True if streaming, otherwise false
+        ///
+        virtual bool isStreaming() const { return false; }
     };
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    template <std::ranges::input_range TRange>
+    void IBufferStorage<T>::updateRange(size_t offset, TRange&& range)
+    {
+        using Value = std::ranges::range_value_t<TRange>;
+
+        if constexpr (std::ranges::contiguous_range<TRange> && std::ranges::sized_range<TRange> && std::is_same_v<Value, T>)
+        {
+            update(offset, std::span<const T>(std::ranges::data(range), std::ranges::size(range)));
+        }
+        else
+        {
+            std::array<T, UploadChunkSize> chunk;
+            size_t filled = 0;
+
+            for (auto&& value : range)
+            {
+                chunk[filled++] = static_cast<T>(value);
+                if (filled == chunk.size())
+                {
+                    update(offset, std::span<const T>(chunk.data(), filled));
+                    offset += filled;
+                    filled = 0;
+                }
+            }
+
+            if (filled > 0)
+                update(offset, std::span<const T>(chunk.data(), filled));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    template <typename TGenerator>
+    void IBufferStorage<T>::generate(size_t offset, size_t count, TGenerator generator)
+    {
+        updateRange(offset, std::views::iota(size_t(0), count) | std::views::transform(generator));
+    }
 }
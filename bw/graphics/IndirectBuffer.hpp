@@ -0,0 +1,91 @@
+#pragma once
+
+#include <type_traits>
+#include "TypedBuffer.hpp"
+#include "BufferSlice.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @struct DrawArraysIndirectCommand
+    /// @brief Parameters of one non-indexed draw read by the GPU from the indirect buffer
+    ///
+    struct DrawArraysIndirectCommand
+    {
+        /// @brief Number of vertices
+        unsigned int count;
+        /// @brief Number of instances
+        unsigned int instanceCount;
+        /// @brief Index of the first vertex
+        unsigned int first;
+        /// @brief Index of the first instance in the per-instance streams
+        unsigned int baseInstance;
+    };
+
+    ///
+    /// @struct DrawElementsIndirectCommand
+    /// @brief Parameters of one indexed draw read by the GPU from the indirect buffer
+    ///
+    struct DrawElementsIndirectCommand
+    {
+        /// @brief Number of indices
+        unsigned int count;
+        /// @brief Number of instances
+        unsigned int instanceCount;
+        /// @brief Index of the first index in the element buffer
+        unsigned int firstIndex;
+        /// @brief Value added to every index (the start of the vertex slice)
+        int baseVertex;
+        /// @brief Index of the first instance in the per-instance streams
+        unsigned int baseInstance;
+    };
+
+    ///
+    /// @brief Makes the command that draws the slice of the shared vertex buffer
+    /// @param vertices Slice of the vertex buffer
+    /// @param instanceCount Number of instances
+    /// @param baseInstance Index of the first instance
+    /// @return Draw command
+    ///
+    inline DrawArraysIndirectCommand makeDrawCommand(BufferSlice vertices, unsigned int instanceCount = 1, unsigned int baseInstance = 0)
+    {
+        return { static_cast<unsigned int>(vertices.count), instanceCount, static_cast<unsigned int>(vertices.offset), baseInstance };
+    }
+
+    ///
+    /// @brief Makes the command that draws the slice of the shared element buffer, indices are relative to the vertex slice
+    /// @param vertices Slice of the vertex buffer
+    /// @param elements Slice of the element buffer
+    /// @param instanceCount Number of instances
+    /// @param baseInstance Index of the first instance
+    /// @return Draw command
+    ///
+    inline DrawElementsIndirectCommand makeDrawCommand(BufferSlice vertices, BufferSlice elements, unsigned int instanceCount = 1, unsigned int baseInstance = 0)
+    {
+        return { static_cast<unsigned int>(elements.count), instanceCount, static_cast<unsigned int>(elements.offset), 
+                 static_cast<int>(vertices.offset), baseInstance };
+    }
+
+    ///
+    /// @class IndirectBuffer
+    /// @brief Class that wraps the functionality of indirect draw buffers in the OpenGL API.
+    /// Thousands of draws with the same state are submitted by RenderCanvas::multiDrawIndirect in one call,
+    /// and the commands can also be written by the GPU itself (e.g. by a culling compute shader)
+    /// @implements IBufferStorage<TCommand>, IResource<unsigned int>
+    /// @tparam TCommand DrawArraysIndirectCommand or DrawElementsIndirectCommand
+    ///
+    template <typename TCommand>
+    class IndirectBuffer : public TypedBuffer<TCommand, DrawIndirectTarget>
+    {
+        static_assert(std::is_same_v<TCommand, DrawArraysIndirectCommand> || std::is_same_v<TCommand, DrawElementsIndirectCommand>,
+                      "Indirect buffers store DrawArraysIndirectCommand or DrawElementsIndirectCommand");
+    public:
+        /// @brief Constant for a non-existent indirect buffer
+        static const unsigned int NullIndirectBuffer = BufferObject::NullBuffer;
+
+        using TypedBuffer<TCommand, DrawIndirectTarget>::TypedBuffer;
+    };
+
+    using ArraysIndirectBuffer = IndirectBuffer<DrawArraysIndirectCommand>;
+    using ElementsIndirectBuffer = IndirectBuffer<DrawElementsIndirectCommand>;
+}
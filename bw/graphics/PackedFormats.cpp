@@ -0,0 +1,99 @@
+#include <bit>
+#include <cmath>
+#include <algorithm>
+#include "PackedFormats.hpp"
+
+namespace bw::low_level
+{
+    std::uint16_t packHalf(float value)
+    {
+        std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+        std::uint32_t sign = (bits >> 16) & 0x8000;
+        std::uint32_t exponent = (bits >> 23) & 0xFF;
+        std::uint32_t mantissa = bits & 0x7FFFFF;
+
+        // Infinity stays infinity, NaN stays quiet NaN
+        if (exponent == 0xFF)
+            return static_cast<std::uint16_t>(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+
+        int halfExponent = static_cast<int>(exponent) - 127 + 15;
+        if (halfExponent >= 0x1F)
+            return static_cast<std::uint16_t>(sign | 0x7C00);
+
+        std::uint32_t half, rest, halfway;
+        if (halfExponent <= 0)
+        {
+            // Too small even for the subnormal halves
+            if (halfExponent < -10)
+                return static_cast<std::uint16_t>(sign);
+
+            // Subnormal half, the implicit leading one becomes explicit
+            mantissa |= 0x800000;
+            std::uint32_t shift = static_cast<std::uint32_t>(14 - halfExponent);
+            half = mantissa >> shift;
+            rest = mantissa & ((1u << shift) - 1);
+            halfway = 1u << (shift - 1);
+        }
+        else
+        {
+            half = (static_cast<std::uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+            rest = mantissa & 0x1FFF;
+            halfway = 0x1000;
+        }
+
+        // Round to nearest even, the carry may go into the exponent (up to the infinity) which is correct
+        if (rest > halfway || (rest == halfway && (half & 1)))
+            half++;
+
+        return static_cast<std::uint16_t>(sign | half);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    float unpackHalf(std::uint16_t bits)
+    {
+        std::uint32_t sign = static_cast<std::uint32_t>(bits & 0x8000) << 16;
+        std::uint32_t exponent = (bits >> 10) & 0x1F;
+        std::uint32_t mantissa = bits & 0x3FF;
+
+        if (exponent == 0)
+        {
+            // Zero or subnormal: mantissa * 2^-24
+            float value = std::ldexp(static_cast<float>(mantissa), -24);
+            return sign ? -value : value;
+        }
+
+        if (exponent == 0x1F)
+            return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13));
+
+        return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    std::uint8_t packUnorm8(float value)
+    {
+        return static_cast<std::uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    float unpackUnorm8(std::uint8_t value)
+    {
+        return value / 255.0f;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    std::uint16_t packUnorm16(float value)
+    {
+        return static_cast<std::uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    float unpackUnorm16(std::uint16_t value)
+    {
+        return value / 65535.0f;
+    }
+}
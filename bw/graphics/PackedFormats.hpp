@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include "math/Vec2.hpp"
+#include "math/Vec4.hpp"
+#include "VertexLayout.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @brief Converts the float to the IEEE 754 half-precision float, rounding to the nearest even value.
+    /// Values out of the half range become infinities
+    /// @param value Source value
+    /// @return Bits of the half-precision float
+    ///
+    std::uint16_t packHalf(float value);
+
+    ///
+    /// @brief Converts the IEEE 754 half-precision float to the float
+    /// @param bits Bits of the half-precision float
+    /// @return Converted value (exact)
+    ///
+    float unpackHalf(std::uint16_t bits);
+
+    ///
+    /// @brief Converts the float in [0, 1] to the normalized 8-bit integer. Values outside the range are clamped
+    /// @param value Source value
+    /// @return Normalized integer (0 to 255)
+    ///
+    std::uint8_t packUnorm8(float value);
+
+    ///
+    /// @brief Converts the normalized 8-bit integer to the float in [0, 1]
+    /// @param value Normalized integer
+    /// @return Converted value
+    ///
+    float unpackUnorm8(std::uint8_t value);
+
+    ///
+    /// @brief Converts the float in [0, 1] to the normalized 16-bit integer. Values outside the range are clamped
+    /// @param value Source value
+    /// @return Normalized integer (0 to 65535)
+    ///
+    std::uint16_t packUnorm16(float value);
+
+    ///
+    /// @brief Converts the normalized 16-bit integer to the float in [0, 1]
+    /// @param value Normalized integer
+    /// @return Converted value
+    ///
+    float unpackUnorm16(std::uint16_t value);
+
+    ///
+    /// @struct Half2
+    /// @brief Two half-precision floats (4 bytes), e.g. texture coordinates
+    ///
+    struct Half2
+    {
+        std::uint16_t x, y;
+
+        Half2(Vec2f value) : x(packHalf(value.x)), y(packHalf(value.y)) { }
+        Half2() : x(0), y(0) { }
+
+        /// @brief Converts the value back to floats
+        Vec2f unpack() const { return { unpackHalf(x), unpackHalf(y) }; }
+    };
+
+    ///
+    /// @struct Half4
+    /// @brief Four half-precision floats (8 bytes), e.g. positions with the padding component
+    ///
+    struct Half4
+    {
+        std::uint16_t x, y, z, w;
+
+        Half4(Vec4f value) : x(packHalf(value.x)), y(packHalf(value.y)), z(packHalf(value.z)), w(packHalf(value.w)) { }
+        Half4() : x(0), y(0), z(0), w(0) { }
+
+        /// @brief Converts the value back to floats
+        Vec4f unpack() const { return { unpackHalf(x), unpackHalf(y), unpackHalf(z), unpackHalf(w) }; }
+    };
+
+    ///
+    /// @struct Unorm8x4
+    /// @brief Four normalized 8-bit integers (4 bytes), read by the shader as floats in [0, 1]. Used for RGBA8 colors
+    ///
+    struct Unorm8x4
+    {
+        std::uint8_t x, y, z, w;
+
+        Unorm8x4(Vec4f value) : x(packUnorm8(value.x)), y(packUnorm8(value.y)), z(packUnorm8(value.z)), w(packUnorm8(value.w)) { }
+        Unorm8x4() : x(0), y(0), z(0), w(0) { }
+
+        /// @brief Converts the value back to floats
+        Vec4f unpack() const { return { unpackUnorm8(x), unpackUnorm8(y), unpackUnorm8(z), unpackUnorm8(w) }; }
+    };
+
+    ///
+    /// @struct Unorm16x2
+    /// @brief Two normalized 16-bit integers (4 bytes), read by the shader as floats in [0, 1].
+    /// Used for texture coordinates that do not repeat
+    ///
+    struct Unorm16x2
+    {
+        std::uint16_t x, y;
+
+        Unorm16x2(Vec2f value) : x(packUnorm16(value.x)), y(packUnorm16(value.y)) { }
+        Unorm16x2() : x(0), y(0) { }
+
+        /// @brief Converts the value back to floats
+        Vec2f unpack() const { return { unpackUnorm16(x), unpackUnorm16(y) }; }
+    };
+
+    using Rgba8 = Unorm8x4;
+
+    ///
+    /// @struct PackedAttributeTraits
+    /// @brief Attribute traits of the packed types read by the shader as floats
+    ///
+    template <unsigned int Type, unsigned int N, bool IsNormalized>
+    struct PackedAttributeTraits
+    {
+        static constexpr unsigned int GLType = Type;
+        static constexpr unsigned int Components = N;
+        static constexpr bool Normalized = IsNormalized;
+        static constexpr bool Integer = false;
+    };
+
+    /// @brief Half2 is read as two GL_HALF_FLOAT components
+    template <>
+    struct AttributeTraits<Half2> : PackedAttributeTraits<0x140B, 2, false> { };
+
+    /// @brief Half4 is read as four GL_HALF_FLOAT components
+    template <>
+    struct AttributeTraits<Half4> : PackedAttributeTraits<0x140B, 4, false> { };
+
+    /// @brief Unorm8x4 is read as four normalized GL_UNSIGNED_BYTE components
+    template <>
+    struct AttributeTraits<Unorm8x4> : PackedAttributeTraits<0x1401, 4, true> { };
+
+    /// @brief Unorm16x2 is read as two normalized GL_UNSIGNED_SHORT components
+    template <>
+    struct AttributeTraits<Unorm16x2> : PackedAttributeTraits<0x1403, 2, true> { };
+}
@@ -0,0 +1,30 @@
+#include "PackedVertex.hpp"
+
+namespace bw::low_level
+{
+    PackedVertex::PackedVertex(const Vertex& vertex)
+        : position(vertex.position), color(vertex.color), texture(Vec2f(vertex.texture.x, vertex.texture.y)) { }
+
+    ////////////////////////////////////////////////////////////
+
+    Vertex PackedVertex::unpack() const
+    {
+        Vec2f uv = texture.unpack();
+        return Vertex(position, color.unpack(), Vec4f(uv.x, uv.y, 0.0f, 0.0f));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    CompactVertex::CompactVertex(const Vertex& vertex)
+        : position(Vec4f(vertex.position.x, vertex.position.y, vertex.position.z, 1.0f)), color(vertex.color),
+          texture(Vec2f(vertex.texture.x, vertex.texture.y)) { }
+
+    ////////////////////////////////////////////////////////////
+
+    Vertex CompactVertex::unpack() const
+    {
+        Vec4f xyzw = position.unpack();
+        Vec2f uv = texture.unpack();
+        return Vertex(Vec3f(xyzw.x, xyzw.y, xyzw.z), color.unpack(), Vec4f(uv.x, uv.y, 0.0f, 0.0f));
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include "PackedFormats.hpp"
+#include "Vertex.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @struct PackedVertex
+    /// @brief Vertex with full-precision position, RGBA8 color and half-precision texture coordinates (20 bytes instead of 44).
+    /// Uses the same attribute locations as Vertex, so the shaders do not change
+    ///
+    struct PackedVertex
+    {
+        Vec3f position;
+        Unorm8x4 color;
+        Half2 texture;
+
+        PackedVertex(Vec3f position, Unorm8x4 color, Half2 texture) : position(position), color(color), texture(texture) { }
+        PackedVertex() = default;
+
+        /// @brief Packs the vertex. Only the first two texture coordinates are kept
+        /// @param vertex Source vertex
+        explicit PackedVertex(const Vertex& vertex);
+
+        /// @brief Unpacks the vertex
+        /// @return Vertex with the unpacked attributes
+        Vertex unpack() const;
+    };
+
+    ///
+    /// @struct CompactVertex
+    /// @brief Vertex with half-precision position, RGBA8 color and normalized 16-bit texture coordinates (16 bytes instead of 44).
+    /// Positions keep about 3 significant digits, so it suits small local-space meshes.
+    /// Texture coordinates are clamped to [0, 1]
+    ///
+    struct CompactVertex
+    {
+        Half4 position;
+        Unorm8x4 color;
+        Unorm16x2 texture;
+
+        CompactVertex(Half4 position, Unorm8x4 color, Unorm16x2 texture) : position(position), color(color), texture(texture) { }
+        CompactVertex() = default;
+
+        /// @brief Packs the vertex. Only the first two texture coordinates are kept
+        /// @param vertex Source vertex
+        explicit CompactVertex(const Vertex& vertex);
+
+        /// @brief Unpacks the vertex
+        /// @return Vertex with the unpacked attributes
+        Vertex unpack() const;
+    };
+
+    template <>
+    struct VertexLayout<PackedVertex>
+    {
+        static constexpr std::array Attributes = {
+            makeAttribute<Vec3f>(0, offsetof(PackedVertex, position)),   // Position (location = 0)
+            makeAttribute<Unorm8x4>(1, offsetof(PackedVertex, color)),   // Color (location = 1)
+            makeAttribute<Half2>(2, offsetof(PackedVertex, texture))     // Texture coordinates (location = 2)
+        };
+    };
+
+    template <>
+    struct VertexLayout<CompactVertex>
+    {
+        static constexpr std::array Attributes = {
+            makeAttribute<Half4>(0, offsetof(CompactVertex, position)),     // Position (location = 0)
+            makeAttribute<Unorm8x4>(1, offsetof(CompactVertex, color)),     // Color (location = 1)
+            makeAttribute<Unorm16x2>(2, offsetof(CompactVertex, texture))   // Texture coordinates (location = 2)
+        };
+    };
+}
@@ -2,6 +2,8 @@
 #include "RenderOptions.hpp"
 #include "ShaderProgram.hpp"
 #include "VertexArray.hpp"
+#include "IndirectBuffer.hpp"
+#include <stdexcept>
 #include <glad/glad.h>
 
 using namespace bw::low_level;
@@ -26,6 +28,115 @@ namespace bw
 
     ////////////////////////////////////////////////////////////
 
+    size_t indexTypeSize(unsigned int indexType)
+    {
+        switch(indexType)
+        {
+            case GL_UNSIGNED_BYTE:  return sizeof(GLubyte);
+            case GL_UNSIGNED_SHORT: return sizeof(GLushort);
+            default:                return sizeof(GLuint);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void requireElements(const low_level::VertexArray& array)
+    {
+        if (!array.hasElements())
+            throw std::logic_error("The vertex array has no element buffer to draw indexed");
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void drawElements(Primitive primitive, const low_level::VertexArray& array, BufferSlice vertices, BufferSlice elements)
+    {
+        requireElements(array);
+
+        auto indexType = array.getIndexType();
+
+        // Indices are relative to the start of the vertex range, so it is passed as the base vertex
+        const void* indexOffset = reinterpret_cast<const void*>(elements.offset * indexTypeSize(indexType));
+
+        glBindVertexArray(array.getNativeHandle());
+        glDrawElementsBaseVertex(primitiveToGLenum(primitive), elements.count, indexType, indexOffset, vertices.offset);
+        glBindVertexArray(low_level::VertexArray::NullVertexArray);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void drawElements(Primitive primitive, const low_level::VertexArray& array)
+    {
+        auto range = array.getRange();
+        auto elementRange = array.getElementRange();
+
+        drawElements(primitive, array, { range.start, range.count }, { elementRange.start, elementRange.count });
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void drawElementsInstanced(Primitive primitive, const low_level::VertexArray& array, size_t instanceCount, size_t baseInstance)
+    {
+        requireElements(array);
+
+        auto range = array.getRange();
+        auto elementRange = array.getElementRange();
+        auto indexType = array.getIndexType();
+
+        const void* indexOffset = reinterpret_cast<const void*>(elementRange.start * indexTypeSize(indexType));
+
+        glBindVertexArray(array.getNativeHandle());
+        glDrawElementsInstancedBaseVertexBaseInstance(primitiveToGLenum(primitive), elementRange.count, indexType, indexOffset, 
+                                                      instanceCount, range.start, baseInstance);
+        glBindVertexArray(low_level::VertexArray::NullVertexArray);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TCommand>
+    void multiDraw(Primitive primitive, const low_level::VertexArray& array, const low_level::IndirectBuffer<TCommand>& commands, 
+                   BufferSlice slice, const IResource<unsigned int>* countBuffer, size_t countOffset)
+    {
+        if (slice.offset + slice.count > commands.size())
+            throw std::out_of_range("The draw commands are out of the indirect buffer");
+
+        if (countOffset % 4 != 0)
+            throw std::invalid_argument("The draw count offset must be a multiple of 4");
+
+        if constexpr (std::is_same_v<TCommand, DrawElementsIndirectCommand>)
+            requireElements(array);
+
+        GLenum mode = primitiveToGLenum(primitive);
+        const void* indirect = reinterpret_cast<const void*>(slice.offset * sizeof(TCommand));
+
+        glBindVertexArray(array.getNativeHandle());
+        commands.bind();
+        if (countBuffer)
+            glBindBuffer(GL_PARAMETER_BUFFER, countBuffer->getNativeHandle());
+
+        // The commands are tightly packed, so the stride is 0
+        if constexpr (std::is_same_v<TCommand, DrawArraysIndirectCommand>)
+        {
+            if (countBuffer)
+                glMultiDrawArraysIndirectCount(mode, indirect, countOffset, slice.count, 0);
+            else
+                glMultiDrawArraysIndirect(mode, indirect, slice.count, 0);
+        }
+        else
+        {
+            if (countBuffer)
+                glMultiDrawElementsIndirectCount(mode, array.getIndexType(), indirect, countOffset, slice.count, 0);
+            else
+                glMultiDrawElementsIndirect(mode, array.getIndexType(), indirect, slice.count, 0);
+        }
+
+        if (countBuffer)
+            glBindBuffer(GL_PARAMETER_BUFFER, 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        glBindVertexArray(low_level::VertexArray::NullVertexArray);
+    }
+
+    ////////////////////////////////////////////////////////////
+
     void RenderCanvas::draw(const RenderOptions& options, const low_level::VertexArray& array)
     {
         auto range = array.getRange();
@@ -53,4 +164,177 @@ namespace bw
         glDrawArrays(primitiveToGLenum(primitive), range.start, range.count);
         glBindVertexArray(low_level::VertexArray::NullVertexArray);
     }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::draw(const RenderOptions& options, const low_level::VertexArray& array, BufferSlice vertices)
+    {
+        if(options.shaderProgram)
+            options.shaderProgram->use();
+
+        draw(options.primitive, array, vertices);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::draw(Primitive primitive, const low_level::VertexArray& array, BufferSlice vertices)
+    {
+        glBindVertexArray(array.getNativeHandle());
+        glDrawArrays(primitiveToGLenum(primitive), vertices.offset, vertices.count);
+        glBindVertexArray(low_level::VertexArray::NullVertexArray);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::drawIndexed(const RenderOptions& options, const low_level::VertexArray& array)
+    {
+        if(options.shaderProgram)
+            options.shaderProgram->use();
+
+        drawElements(options.primitive, array);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::drawIndexed(Primitive primitive, const low_level::VertexArray& array)
+    {
+        drawElements(primitive, array);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::drawIndexed(const RenderOptions& options, const low_level::VertexArray& array, 
+                                   BufferSlice vertices, BufferSlice elements)
+    {
+        if(options.shaderProgram)
+            options.shaderProgram->use();
+
+        drawElements(options.primitive, array, vertices, elements);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::drawIndexed(Primitive primitive, const low_level::VertexArray& array, 
+                                   BufferSlice vertices, BufferSlice elements)
+    {
+        drawElements(primitive, array, vertices, elements);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::drawInstanced(const RenderOptions& options, const low_level::VertexArray& array, size_t instanceCount, size_t baseInstance)
+    {
+        if(options.shaderProgram)
+            options.shaderProgram->use();
+
+        drawInstanced(options.primitive, array, instanceCount, baseInstance);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::drawInstanced(Primitive primitive, const low_level::VertexArray& array, size_t instanceCount, size_t baseInstance)
+    {
+        auto range = array.getRange();
+
+        glBindVertexArray(array.getNativeHandle());
+        glDrawArraysInstancedBaseInstance(primitiveToGLenum(primitive), range.start, range.count, instanceCount, baseInstance);
+        glBindVertexArray(low_level::VertexArray::NullVertexArray);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::drawIndexedInstanced(const RenderOptions& options, const low_level::VertexArray& array, size_t instanceCount, size_t baseInstance)
+    {
+        if(options.shaderProgram)
+            options.shaderProgram->use();
+
+        drawElementsInstanced(options.primitive, array, instanceCount, baseInstance);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::drawIndexedInstanced(Primitive primitive, const low_level::VertexArray& array, size_t instanceCount, size_t baseInstance)
+    {
+        drawElementsInstanced(primitive, array, instanceCount, baseInstance);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::multiDrawIndirect(const RenderOptions& options, const low_level::VertexArray& array, 
+                                         const low_level::IndirectBuffer<DrawArraysIndirectCommand>& commands, BufferSlice slice)
+    {
+        if(options.shaderProgram)
+            options.shaderProgram->use();
+
+        multiDraw(options.primitive, array, commands, slice, nullptr, 0);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::multiDrawIndirect(Primitive primitive, const low_level::VertexArray& array, 
+                                         const low_level::IndirectBuffer<DrawArraysIndirectCommand>& commands, BufferSlice slice)
+    {
+        multiDraw(primitive, array, commands, slice, nullptr, 0);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::multiDrawIndirect(const RenderOptions& options, const low_level::VertexArray& array, 
+                                         const low_level::IndirectBuffer<DrawElementsIndirectCommand>& commands, BufferSlice slice)
+    {
+        if(options.shaderProgram)
+            options.shaderProgram->use();
+
+        multiDraw(options.primitive, array, commands, slice, nullptr, 0);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::multiDrawIndirect(Primitive primitive, const low_level::VertexArray& array, 
+                                         const low_level::IndirectBuffer<DrawElementsIndirectCommand>& commands, BufferSlice slice)
+    {
+        multiDraw(primitive, array, commands, slice, nullptr, 0);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::multiDrawIndirectCount(const RenderOptions& options, const low_level::VertexArray& array, 
+                                              const low_level::IndirectBuffer<DrawArraysIndirectCommand>& commands,
+                                              const IResource<unsigned int>& countBuffer, size_t countOffset, size_t maxDrawCount)
+    {
+        if(options.shaderProgram)
+            options.shaderProgram->use();
+
+        multiDraw(options.primitive, array, commands, { 0, maxDrawCount }, &countBuffer, countOffset);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::multiDrawIndirectCount(Primitive primitive, const low_level::VertexArray& array, 
+                                              const low_level::IndirectBuffer<DrawArraysIndirectCommand>& commands,
+                                              const IResource<unsigned int>& countBuffer, size_t countOffset, size_t maxDrawCount)
+    {
+        multiDraw(primitive, array, commands, { 0, maxDrawCount }, &countBuffer, countOffset);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::multiDrawIndirectCount(const RenderOptions& options, const low_level::VertexArray& array, 
+                                              const low_level::IndirectBuffer<DrawElementsIndirectCommand>& commands,
+                                              const IResource<unsigned int>& countBuffer, size_t countOffset, size_t maxDrawCount)
+    {
+        if(options.shaderProgram)
+            options.shaderProgram->use();
+
+        multiDraw(options.primitive, array, commands, { 0, maxDrawCount }, &countBuffer, countOffset);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void RenderCanvas::multiDrawIndirectCount(Primitive primitive, const low_level::VertexArray& array, 
+                                              const low_level::IndirectBuffer<DrawElementsIndirectCommand>& commands,
+                                              const IResource<unsigned int>& countBuffer, size_t countOffset, size_t maxDrawCount)
+    {
+        multiDraw(primitive, array, commands, { 0, maxDrawCount }, &countBuffer, countOffset);
+    }
 }
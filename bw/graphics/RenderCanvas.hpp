@@ -1,12 +1,21 @@
 #pragma once
 
+#include <cstddef>
 #include "RenderOptions.hpp"
+#include "BufferSlice.hpp"
+#include "IResource.hpp"
 
 namespace bw
 {
     namespace low_level
     {
         class VertexArray;
+
+        struct DrawArraysIndirectCommand;
+        struct DrawElementsIndirectCommand;
+
+        template <typename TCommand>
+        class IndirectBuffer;
     }
 
     /// @class RenderCanvas
@@ -23,5 +32,173 @@ namespace bw
         /// @param primitive Primitive to draw
         /// @param array Vertex array object
         virtual void draw(low_level::Primitive primitive, const low_level::VertexArray& array);  
+
+        /// @brief Draws a slice of the vertex buffer bound to the `array` using the `render options`.
+        /// Allows many meshes sharing one buffer to be drawn with one vertex array
+        /// @param options Rendering options
+        /// @param array Vertex array object
+        /// @param vertices Slice of the bound vertex buffer
+        virtual void draw(const RenderOptions& options, const low_level::VertexArray& array, low_level::BufferSlice vertices);
+
+        /// @brief Draws a slice of the vertex buffer bound to the `array` by `primitive`
+        /// @param primitive Primitive to draw
+        /// @param array Vertex array object
+        /// @param vertices Slice of the bound vertex buffer
+        virtual void draw(low_level::Primitive primitive, const low_level::VertexArray& array, low_level::BufferSlice vertices);
+
+        /// @brief Draws an `array` with the attached element buffer on the canvas using the `render options`
+        /// @param options Rendering options
+        /// @param array Vertex array object with attached element buffer
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void drawIndexed(const RenderOptions& options, const low_level::VertexArray& array);
+
+        /// @brief Draws an `array` with the attached element buffer on the canvas by `primitive`
+        /// @param primitive Primitive to draw
+        /// @param array Vertex array object with attached element buffer
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void drawIndexed(low_level::Primitive primitive, const low_level::VertexArray& array);
+
+        /// @brief Draws a slice of the attached element buffer using the `render options`.
+        /// Indices are relative to the start of the vertex slice, which is passed as the base vertex
+        /// @param options Rendering options
+        /// @param array Vertex array object with attached element buffer
+        /// @param vertices Slice of the bound vertex buffer
+        /// @param elements Slice of the attached element buffer
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void drawIndexed(const RenderOptions& options, const low_level::VertexArray& array, 
+                                 low_level::BufferSlice vertices, low_level::BufferSlice elements);
+
+        /// @brief Draws a slice of the attached element buffer by `primitive`
+        /// @param primitive Primitive to draw
+        /// @param array Vertex array object with attached element buffer
+        /// @param vertices Slice of the bound vertex buffer
+        /// @param elements Slice of the attached element buffer
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void drawIndexed(low_level::Primitive primitive, const low_level::VertexArray& array, 
+                                 low_level::BufferSlice vertices, low_level::BufferSlice elements);
+
+        /// @brief Draws `instanceCount` instances of an `array` with one call using the `render options`.
+        /// Streams bound with a divisor advance per instance instead of per vertex
+        /// @param options Rendering options
+        /// @param array Vertex array object
+        /// @param instanceCount Number of instances
+        /// @param baseInstance Index of the first instance in the per-instance streams
+        virtual void drawInstanced(const RenderOptions& options, const low_level::VertexArray& array, size_t instanceCount, size_t baseInstance = 0);
+
+        /// @brief Draws `instanceCount` instances of an `array` with one call by `primitive`
+        /// @param primitive Primitive to draw
+        /// @param array Vertex array object
+        /// @param instanceCount Number of instances
+        /// @param baseInstance Index of the first instance in the per-instance streams
+        virtual void drawInstanced(low_level::Primitive primitive, const low_level::VertexArray& array, size_t instanceCount, size_t baseInstance = 0);
+
+        /// @brief Draws `instanceCount` instances of an `array` with the attached element buffer using the `render options`
+        /// @param options Rendering options
+        /// @param array Vertex array object with attached element buffer
+        /// @param instanceCount Number of instances
+        /// @param baseInstance Index of the first instance in the per-instance streams
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void drawIndexedInstanced(const RenderOptions& options, const low_level::VertexArray& array, size_t instanceCount, size_t baseInstance = 0);
+
+        /// @brief Draws `instanceCount` instances of an `array` with the attached element buffer by `primitive`
+        /// @param primitive Primitive to draw
+        /// @param array Vertex array object with attached element buffer
+        /// @param instanceCount Number of instances
+        /// @param baseInstance Index of the first instance in the per-instance streams
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void drawIndexedInstanced(low_level::Primitive primitive, const low_level::VertexArray& array, size_t instanceCount, size_t baseInstance = 0);
+
+        /// @brief Submits the slice of the draw commands for the vertex buffer bound to the `array` in one call using the `render options`
+        /// @param options Rendering options
+        /// @param array Vertex array object
+        /// @param commands Indirect buffer of the commands
+        /// @param slice Slice of the commands to submit
+        /// @throw std::out_of_range If the slice is out of the indirect buffer
+        virtual void multiDrawIndirect(const RenderOptions& options, const low_level::VertexArray& array, 
+                                       const low_level::IndirectBuffer<low_level::DrawArraysIndirectCommand>& commands, low_level::BufferSlice slice);
+
+        /// @brief Submits the slice of the draw commands for the vertex buffer bound to the `array` in one call by `primitive`
+        /// @param primitive Primitive to draw
+        /// @param array Vertex array object
+        /// @param commands Indirect buffer of the commands
+        /// @param slice Slice of the commands to submit
+        /// @throw std::out_of_range If the slice is out of the indirect buffer
+        virtual void multiDrawIndirect(low_level::Primitive primitive, const low_level::VertexArray& array, 
+                                       const low_level::IndirectBuffer<low_level::DrawArraysIndirectCommand>& commands, low_level::BufferSlice slice);
+
+        /// @brief Submits the slice of the indexed draw commands for the element buffer attached to the `array` in one call using the `render options`
+        /// @param options Rendering options
+        /// @param array Vertex array object with attached element buffer
+        /// @param commands Indirect buffer of the commands
+        /// @param slice Slice of the commands to submit
+        /// @throw std::out_of_range If the slice is out of the indirect buffer
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void multiDrawIndirect(const RenderOptions& options, const low_level::VertexArray& array, 
+                                       const low_level::IndirectBuffer<low_level::DrawElementsIndirectCommand>& commands, low_level::BufferSlice slice);
+
+        /// @brief Submits the slice of the indexed draw commands for the element buffer attached to the `array` in one call by `primitive`
+        /// @param primitive Primitive to draw
+        /// @param array Vertex array object with attached element buffer
+        /// @param commands Indirect buffer of the commands
+        /// @param slice Slice of the commands to submit
+        /// @throw std::out_of_range If the slice is out of the indirect buffer
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void multiDrawIndirect(low_level::Primitive primitive, const low_level::VertexArray& array, 
+                                       const low_level::IndirectBuffer<low_level::DrawElementsIndirectCommand>& commands, low_level::BufferSlice slice);
+
+        /// @brief Submits the draw commands in one call using the `render options`, the number of commands is read by the GPU from the buffer.
+        /// Lets the GPU decide how many objects are drawn (e.g. after culling) without reading the count back
+        /// @param options Rendering options
+        /// @param array Vertex array object
+        /// @param commands Indirect buffer of the commands, submitted from the beginning
+        /// @param countBuffer Buffer containing the number of commands as an unsigned int
+        /// @param countOffset Offset of the number in the count buffer in bytes (multiple of 4)
+        /// @param maxDrawCount Maximum number of commands to submit
+        /// @throw std::out_of_range If the maximum number of commands is bigger than the indirect buffer
+        /// @throw std::invalid_argument If the count offset is not a multiple of 4
+        virtual void multiDrawIndirectCount(const RenderOptions& options, const low_level::VertexArray& array, 
+                                            const low_level::IndirectBuffer<low_level::DrawArraysIndirectCommand>& commands,
+                                            const IResource<unsigned int>& countBuffer, size_t countOffset, size_t maxDrawCount);
+
+        /// @brief Submits the draw commands in one call by `primitive`, the number of commands is read by the GPU from the buffer
+        /// @param primitive Primitive to draw
+        /// @param array Vertex array object
+        /// @param commands Indirect buffer of the commands, submitted from the beginning
+        /// @param countBuffer Buffer containing the number of commands as an unsigned int
+        /// @param countOffset Offset of the number in the count buffer in bytes (multiple of 4)
+        /// @param maxDrawCount Maximum number of commands to submit
+        /// @throw std::out_of_range If the maximum number of commands is bigger than the indirect buffer
+        /// @throw std::invalid_argument If the count offset is not a multiple of 4
+        virtual void multiDrawIndirectCount(low_level::Primitive primitive, const low_level::VertexArray& array, 
+                                            const low_level::IndirectBuffer<low_level::DrawArraysIndirectCommand>& commands,
+                                            const IResource<unsigned int>& countBuffer, size_t countOffset, size_t maxDrawCount);
+
+        /// @brief Submits the indexed draw commands in one call using the `render options`, the number of commands is read by the GPU from the buffer
+        /// @param options Rendering options
+        /// @param array Vertex array object with attached element buffer
+        /// @param commands Indirect buffer of the commands, submitted from the beginning
+        /// @param countBuffer Buffer containing the number of commands as an unsigned int
+        /// @param countOffset Offset of the number in the count buffer in bytes (multiple of 4)
+        /// @param maxDrawCount Maximum number of commands to submit
+        /// @throw std::out_of_range If the maximum number of commands is bigger than the indirect buffer
+        /// @throw std::invalid_argument If the count offset is not a multiple of 4
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void multiDrawIndirectCount(const RenderOptions& options, const low_level::VertexArray& array, 
+                                            const low_level::IndirectBuffer<low_level::DrawElementsIndirectCommand>& commands,
+                                            const IResource<unsigned int>& countBuffer, size_t countOffset, size_t maxDrawCount);
+
+        /// @brief Submits the indexed draw commands in one call by `primitive`, the number of commands is read by the GPU from the buffer
+        /// @param primitive Primitive to draw
+        /// @param array Vertex array object with attached element buffer
+        /// @param commands Indirect buffer of the commands, submitted from the beginning
+        /// @param countBuffer Buffer containing the number of commands as an unsigned int
+        /// @param countOffset Offset of the number in the count buffer in bytes (multiple of 4)
+        /// @param maxDrawCount Maximum number of commands to submit
+        /// @throw std::out_of_range If the maximum number of commands is bigger than the indirect buffer
+        /// @throw std::invalid_argument If the count offset is not a multiple of 4
+        /// @throw std::logic_error If the array has no element buffer
+        virtual void multiDrawIndirectCount(low_level::Primitive primitive, const low_level::VertexArray& array, 
+                                            const low_level::IndirectBuffer<low_level::DrawElementsIndirectCommand>& commands,
+                                            const IResource<unsigned int>& countBuffer, size_t countOffset, size_t maxDrawCount);
 	};
 }
@@ -112,6 +112,7 @@ namespace bw::low_level
         {
             case GL_VERTEX_SHADER:   return Type::Vertex;
             case GL_FRAGMENT_SHADER: return Type::Fragment;
+            case GL_COMPUTE_SHADER:  return Type::Compute;
             default:                 return Type::Geometric;
         }
     }
@@ -137,6 +138,7 @@ namespace bw::low_level
         {
             case Type::Vertex:   shaderType = GL_VERTEX_SHADER; break;
             case Type::Fragment: shaderType = GL_FRAGMENT_SHADER; break;
+            case Type::Compute:  shaderType = GL_COMPUTE_SHADER; break;
             default:             shaderType = GL_GEOMETRY_SHADER; break;
         }
 
@@ -22,7 +22,8 @@ namespace bw::low_level
         {
             Vertex,
             Fragment,
-            Geometric
+            Geometric,
+            Compute
         };
 
         /// @brief Constant for a non-existent shader
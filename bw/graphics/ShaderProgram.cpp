@@ -118,6 +118,13 @@ namespace bw::low_level
 
     ////////////////////////////////////////////////////////////
 
+    unsigned int ShaderProgram::getNativeHandle() const
+    {
+        return _handle;
+    }
+
+    ////////////////////////////////////////////////////////////
+
     void ShaderProgram::release()
     {
         if(_handle != NullShaderProgram)
@@ -41,6 +41,10 @@ namespace bw::low_level
         /// @brief Uses shader program
         void use() const;
 
+        /// @brief Gets shader program native handle
+        /// @return OpenGL program handle
+        unsigned int getNativeHandle() const;
+
         /// @brief Releases shader program and automatically detaches all shaders
         void release() override;
     private:
@@ -2,6 +2,8 @@
 #include "utils/Logger.hpp"
 #include "ext/GLLogging.hpp"
 #include "SimpleWindow.hpp"
+#include "GpuFence.hpp"
+#include <array>
 
 #if defined(_WIN32)
 #define GLFW_EXPOSE_NATIVE_WIN32
@@ -26,6 +28,8 @@ namespace bw
 	struct WindowImpl
 	{
 		GLFWwindow* glfwWindow;
+		std::array<low_level::GpuFence, SimpleWindow::FramesInFlight> frameFences;
+		size_t frameIndex = 0;
 	};
 
 	////////////////////////////////////////////////////////////
@@ -94,6 +98,13 @@ namespace bw
 	SimpleWindow::~SimpleWindow()
 	{
 		auto title = getTitle();
+
+		// Sync objects must be deleted while the context is alive
+		for (auto& fence : _impl->frameFences)
+		{
+			fence.release();
+		}
+
 		glfwDestroyWindow(_impl->glfwWindow);
         glfwTerminate();
 		_logger.info(std::format("SimpleWindow with the title \"{}\" destroyed", title));
@@ -141,6 +152,12 @@ namespace bw
 	void SimpleWindow::update()
 	{
 		glfwSwapBuffers(_impl->glfwWindow);
+
+		// The next slot is reused only after the GPU has finished the frame that used it
+		_impl->frameFences[_impl->frameIndex].signal();
+		_impl->frameIndex = (_impl->frameIndex + 1) % FramesInFlight;
+		_impl->frameFences[_impl->frameIndex].wait();
+
 		glfwPollEvents();
 
         int error = glGetError();
@@ -202,6 +219,13 @@ namespace bw
 
 	////////////////////////////////////////////////////////////
 
+	size_t SimpleWindow::getFrameIndex() const
+	{
+		return _impl->frameIndex;
+	}
+
+	////////////////////////////////////////////////////////////
+
 	void* SimpleWindow::getNativeHandle()
 	{
 #if defined(_WIN32)
@@ -18,6 +18,9 @@ namespace bw
 	class SimpleWindow : public IWindowBase, IWindowApi
 	{
 	public:
+		/// @brief Number of frames the CPU may prepare ahead of the GPU
+		static const size_t FramesInFlight = 3;
+
 		/// @brief Construct window with title and rectangular area
 		/// @param title SimpleWindow title/caption
 		/// @param rect SimpleWindow position and size rectangle
@@ -59,7 +62,8 @@ namespace bw
 		/// @param color RGBA color to clear with
 		virtual void clear(Vec4i color) override;
 		
-        /// @brief Update window display (swap buffers, present render)
+        /// @brief Update window display (swap buffers, present render).
+		/// Fences the presented frame and waits until the GPU finishes the frame that used the next slot of the frame ring
 		virtual void update() override;
 
 		/// @brief Check if window is currently visible
@@ -85,6 +89,11 @@ namespace bw
 		/// @return Current window title string
 		virtual std::string getTitle() const;
 
+		/// @brief Get index of the current frame in the ring of frames in flight.
+		/// Dynamic data indexed by it can be rewritten without waiting for the GPU
+		/// @return Frame index in the range [0, FramesInFlight)
+		size_t getFrameIndex() const;
+
 		// IWindowApi interface implementation
         
 		/// @brief Get native platform-specific window handle
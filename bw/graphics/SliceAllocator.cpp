@@ -0,0 +1,117 @@
+#include <stdexcept>
+#include <iterator>
+#include <algorithm>
+#include "SliceAllocator.hpp"
+
+namespace bw::low_level
+{
+    SliceAllocator::SliceAllocator(size_t capacity) : _capacity(0), _used(0)
+    {
+        grow(capacity);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    std::optional<BufferSlice> SliceAllocator::allocate(size_t count)
+    {
+        if(count == 0)
+            return BufferSlice();
+
+        for(auto it = _free.begin(); it != _free.end(); ++it)
+        {
+            auto [offset, size] = *it;
+            if(size < count) continue;
+
+            _free.erase(it);
+            if(size > count)
+                _free.emplace(offset + count, size - count);
+
+            _used += count;
+            return BufferSlice(offset, count);
+        }
+        return std::nullopt;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void SliceAllocator::free(BufferSlice slice)
+    {
+        if(slice.empty()) return;
+
+        if(slice.end() > _capacity)
+            throw std::out_of_range("The slice is out of the allocator range");
+
+        auto next = _free.lower_bound(slice.offset);
+        if((next != _free.end() && next->first < slice.end()) ||
+           (next != _free.begin() && std::prev(next)->first + std::prev(next)->second > slice.offset))
+            throw std::invalid_argument("The slice overlaps a free range");
+
+        _used -= slice.count;
+
+        // Merge with the free neighbours
+        if(next != _free.end() && next->first == slice.end())
+        {
+            slice.count += next->second;
+            next = _free.erase(next);
+        }
+        if(next != _free.begin())
+        {
+            auto prev = std::prev(next);
+            if(prev->first + prev->second == slice.offset)
+            {
+                prev->second += slice.count;
+                return;
+            }
+        }
+        _free.emplace(slice.offset, slice.count);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void SliceAllocator::grow(size_t capacity)
+    {
+        if(capacity <= _capacity) return;
+
+        size_t oldCapacity = _capacity;
+        _capacity = capacity;
+
+        _used += capacity - oldCapacity;
+        free({ oldCapacity, capacity - oldCapacity });
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void SliceAllocator::reset()
+    {
+        _free.clear();
+        _used = 0;
+        if(_capacity > 0)
+            _free.emplace(0, _capacity);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    size_t SliceAllocator::capacity() const
+    {
+        return _capacity;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    size_t SliceAllocator::used() const
+    {
+        return _used;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    size_t SliceAllocator::largestFree() const
+    {
+        size_t largest = 0;
+        for(auto& [offset, size] : _free)
+        {
+            largest = std::max(largest, size);
+        }
+        return largest;
+    }
+}
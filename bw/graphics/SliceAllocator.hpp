@@ -0,0 +1,55 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include "BufferSlice.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @class SliceAllocator
+    /// @brief First-fit free-list allocator that hands out slices of an abstract range of elements
+    /// 
+    /// The allocator does not touch any GPU memory, it only keeps track of the free ranges.
+    /// Freed slices are merged with their free neighbours, so the fragmentation does not grow over time.
+    ///
+    class SliceAllocator
+    {
+    public:
+        /// @brief Creates allocator over the range of elements
+        /// @param capacity Number of elements available for allocation
+        SliceAllocator(size_t capacity = 0);
+
+        /// @brief Allocates a slice of the continuous elements
+        /// @param count Number of elements
+        /// @return Allocated slice or std::nullopt if no free range is large enough
+        std::optional<BufferSlice> allocate(size_t count);
+
+        /// @brief Returns the slice to the allocator
+        /// @param slice Slice previously returned by allocate()
+        void free(BufferSlice slice);
+
+        /// @brief Extends the range of elements, the new elements become free
+        /// @param capacity New number of elements (ignored if not greater than the current one)
+        void grow(size_t capacity);
+
+        /// @brief Frees all slices at once
+        void reset();
+
+        /// @brief Gets the number of elements available for allocation
+        /// @return Capacity in number of elements
+        size_t capacity() const;
+
+        /// @brief Gets the number of allocated elements
+        /// @return Used elements
+        size_t used() const;
+
+        /// @brief Gets the size of the largest free range
+        /// @return Maximum number of elements that can be allocated without growth
+        size_t largestFree() const;
+    private:
+        std::map<size_t, size_t> _free;
+        size_t _capacity;
+        size_t _used;
+    };
+}
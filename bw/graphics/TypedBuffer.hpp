@@ -0,0 +1,227 @@
+#pragma once
+
+#include "IBufferStorage.hpp"
+#include <vector>
+#include <optional>
+#include <type_traits>
+#include "BufferObject.hpp"
+#include "BufferReadback.hpp"
+#include "BufferShadow.hpp"
+#include "IResource.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @class TypedBuffer
+    /// @brief Class that wraps the functionality of OpenGL buffers storing the elements of one type.
+    ///
+    /// Vertex, element, uniform, shader storage and indirect buffers share the same upload paths
+    /// (shadow copy, orphaning, GPU-side copies), only the binding target is different.
+    /// The elements are copied as raw bytes, so the element type must be trivially copyable.
+    ///
+    /// @implements IBufferStorage<T>, IResource<unsigned int>
+    /// @tparam T Element type
+    /// @tparam Target Binding target of the buffer
+    ///
+    template <typename T, BufferTarget Target>
+    class TypedBuffer : public virtual IBufferStorage<T>,
+                        public virtual IResource<unsigned int>
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Elements of the GPU buffers must be trivially copyable");
+    public:
+        /// @brief Binding target of the buffer
+        static constexpr BufferTarget TargetType = Target;
+
+        /// @brief Constant for a non-existent buffer
+        static const unsigned int NullBuffer = BufferObject::NullBuffer;
+
+        /// @brief Creates and initializes an empty buffer with no memory
+        /// @param usage Buffer usage type
+        TypedBuffer(BufferUsage usage);
+
+        /// @brief Creates and initializes a buffer, and then fills it with the data
+        /// @param usage Buffer usage type
+        /// @param initializer Initialization data
+        TypedBuffer(BufferUsage usage, std::span<const T> initializer);
+
+        /// @brief Creates and initializes a buffer, then reserves memory for future data
+        /// @param usage Buffer usage type
+        /// @param reserveSize Number of elements for which memory will be allocated
+        TypedBuffer(BufferUsage usage, size_t reserveSize);
+
+        TypedBuffer(const TypedBuffer& other);
+        TypedBuffer(TypedBuffer&& moved) noexcept;
+
+        virtual ~TypedBuffer() = default;
+
+        TypedBuffer& operator=(const TypedBuffer& other);
+        TypedBuffer& operator=(TypedBuffer&& moved) noexcept;
+
+        bool operator==(const TypedBuffer& other) const;
+        bool operator!=(const TypedBuffer& other) const;
+
+        /// @brief Reserve memory for the buffer without initializing it and deleting old data
+        /// @param size Number of elements to reserve capacity for
+        void reserve(size_t size) override;
+
+        /// @brief Update buffer contents with new data
+        /// @param data Span containing the new data to update the buffer with
+        void update(std::span<const T> data) override;
+
+        /// @brief Update buffer contents with new data
+        /// @param offset Offset from the beginning of the previous data
+        /// @param data Span containing the new data to update the buffer with
+        void update(size_t offset, std::span<const T> data) override;
+
+        /// @brief Replace the whole buffer contents, discarding the previous data.
+        /// The storage is orphaned first, so the driver can hand out new memory instead of waiting
+        /// for the GPU to finish reading the old one. Intended for buffers rewritten every frame
+        /// @param data Span containing the new data (the buffer grows if it does not fit)
+        virtual void updateDiscard(std::span<const T> data);
+
+        /// @brief Copy contents of this buffer to another buffer. Pending shadow changes are not copied until flush()
+        /// @param buffer Destination buffer to copy data to
+        /// @throw std::logic_error If the contents are read on the CPU side and the buffer cannot be mapped
+        void copyTo(IBufferStorage<T>& buffer) const override;
+
+        /// @brief Copy the regions of this buffer to another buffer with one GPU-side copy per merged region.
+        /// Pending shadow changes are not copied until flush()
+        /// @param buffer Destination buffer (may be this buffer)
+        /// @param regions Regions in number of elements, they are validated, sorted and merged in place
+        /// @throw std::logic_error If the contents are read on the CPU side and the buffer cannot be mapped
+        void copyRanges(IBufferStorage<T>& buffer, std::span<CopyRegion> regions) const override;
+
+        /// @brief Get a copy of the buffer data
+        /// @return Vector containing a copy of all buffer data
+        std::vector<T> data() const override;
+
+        /// @brief Get a copy of the buffer data
+        /// @return Vector containing a copy of the data of the specified range in the buffer
+        /// @param offset Offset from the beginning of the data
+        /// @param size Count of the elements
+        std::vector<T> data(size_t offset, size_t size) const;
+
+        /// @brief Read buffer data into the caller's memory without allocating
+        /// @param out Destination span, its size defines the number of elements to read
+        /// @param offset Offset from the beginning of the data
+        void readInto(std::span<T> out, size_t offset = 0) const override;
+
+        /// @brief Schedules the readback of the buffer data without stalling the pipeline.
+        /// The GPU memory is read, so pending shadow changes are not seen until flush()
+        /// @param offset Offset from the beginning of the data
+        /// @param count Count of the elements
+        /// @return Readback with its own staging buffer that can be polled and resolved when the data is ready
+        /// @throw std::out_of_range If the range is out of the buffer
+        AsyncReadback<T> readAsync(size_t offset, size_t count) const;
+
+        /// @brief Schedules the readback of the buffer data into the staging ring, for the readbacks made every frame.
+        /// The GPU memory is read, so pending shadow changes are not seen until flush()
+        /// @param ring Staging ring of the readbacks
+        /// @param offset Offset from the beginning of the data
+        /// @param count Count of the elements
+        /// @return Readback valid for the frame count of the ring
+        /// @throw std::out_of_range If the range is out of the buffer
+        AsyncReadback<T> readAsync(ReadbackRing& ring, size_t offset, size_t count) const;
+
+        /// @brief Get the current max number of elements buffer can store
+        /// @return Size of the buffer in number of elements
+        size_t size() const override;
+
+        /// @brief Get the total capacity of the buffer. The value is cached and does not query the driver
+        /// @return Maximum memory the buffer can hold without reallocation
+        size_t capacity() const override;
+
+        /// @brief Enables the CPU-side shadow copy of the buffer data. Updates are then written only to the copy
+        /// and collected as dirty ranges, which are merged and uploaded by flush()
+        /// @param mergeGap Maximum gap in elements between two dirty ranges uploaded as one region
+        virtual void enableShadow(size_t mergeGap = BufferShadow<T>::DefaultMergeGap);
+
+        /// @brief Uploads the pending changes and disables the shadow copy
+        void disableShadow();
+
+        /// @brief Check if the shadow copy is enabled
+        /// @return True if enabled, otherwise false
+        bool hasShadow() const;
+
+        /// @brief Uploads the dirty ranges of the shadow copy with the minimum number of driver calls.
+        /// Intended to be called once per frame before drawing
+        void flush();
+
+        /// @brief Gets the statistics of the shadow copy uploads
+        /// @return Bytes touched by the updates and bytes actually uploaded (zeros if the shadow copy is disabled)
+        ShadowStats getShadowStats() const;
+
+        /// @brief Resets the statistics of the shadow copy uploads
+        void resetShadowStats();
+
+        /// @brief Get the current usage type of the buffer
+        /// @return Buffer usage type
+        BufferUsage getUsage() const;
+
+        /// @brief Binds the buffer to its target
+        void bind() const;
+
+        /// @brief Binds the whole buffer to the indexed binding point of a uniform or shader storage buffer
+        /// @param index Binding point index
+        void bindBase(unsigned int index) const requires (Target == UniformTarget || Target == ShaderStorageTarget);
+
+        /// @brief Binds the range of the buffer to the indexed binding point of a uniform or shader storage buffer
+        /// @param index Binding point index
+        /// @param offset Offset of the first element (its byte offset must follow the alignment of the target)
+        /// @param count Number of elements
+        void bindRange(unsigned int index, size_t offset, size_t count) const requires (Target == UniformTarget || Target == ShaderStorageTarget);
+
+        /// @brief Binds the whole buffer to the indexed shader storage binding point whatever its own target is,
+        /// so compute shaders can write vertices, indices or draw commands in place
+        /// @param index Binding point index
+        void bindStorage(unsigned int index) const;
+
+        /// @brief Binds the range of the buffer to the indexed shader storage binding point whatever its own target is
+        /// @param index Binding point index
+        /// @param offset Offset of the first element (its byte offset must follow the shader storage alignment)
+        /// @param count Number of elements
+        void bindStorageRange(unsigned int index, size_t offset, size_t count) const;
+
+		/// @brief Gets buffer native handle
+		/// @return OpenGL buffer handle
+		unsigned int getNativeHandle() const override;
+
+        /// @brief Releases buffer memory
+        void release() override;
+    protected:
+        BufferObject _storage;
+        std::optional<BufferShadow<T>> _shadow;
+
+        ///
+        /// @class ReadScope
+        /// @brief Keeps the buffer contents readable on the CPU side while the scope is alive,
+        /// so the mapping is released even if the copy throws
+        ///
+        class ReadScope
+        {
+        public:
+            ReadScope(const TypedBuffer& buffer);
+
+            ReadScope(const ReadScope&) = delete;
+            ReadScope& operator=(const ReadScope&) = delete;
+
+            ~ReadScope();
+
+            /// @brief Gets the readable contents
+            /// @return Pointer to the first element
+            const T* data() const;
+        private:
+            const TypedBuffer& _buffer;
+            const T* _data;
+            std::vector<T> _copy;
+        };
+    };
+
+    template <typename T>
+    using UniformBuffer = TypedBuffer<T, BufferTarget::UniformTarget>;
+
+    template <typename T>
+    using StorageBuffer = TypedBuffer<T, BufferTarget::ShaderStorageTarget>;
+}
+
+#include "TypedBuffer.tpp"
@@ -0,0 +1,425 @@
+#ifndef TYPEDBUFFER_TPP
+#define TYPEDBUFFER_TPP
+
+#include <stdexcept>
+#include <algorithm>
+
+namespace bw::low_level
+{
+    template <typename T, BufferTarget Target>
+    TypedBuffer<T, Target>::TypedBuffer(BufferUsage usage) : _storage(usage) { }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    TypedBuffer<T, Target>::TypedBuffer(BufferUsage usage, std::span<const T> initializer)
+        : _storage(usage, initializer.data(), initializer.size() * sizeof(T)) { }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    TypedBuffer<T, Target>::TypedBuffer(BufferUsage usage, size_t reserveSize) : _storage(usage, nullptr, reserveSize * sizeof(T)) { }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    TypedBuffer<T, Target>::TypedBuffer(const TypedBuffer& other) : _storage(other.getUsage())
+    {
+        this->reserve(other.size());
+        other.copyTo(*this);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    TypedBuffer<T, Target>::TypedBuffer(TypedBuffer&& moved) noexcept : _storage(std::move(moved._storage)), _shadow(std::move(moved._shadow))
+    {
+        moved._shadow.reset();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    TypedBuffer<T, Target>& TypedBuffer<T, Target>::operator=(const TypedBuffer& other)
+    {
+        if (this != &other)
+        {
+            other.copyTo(*this);
+        }
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    TypedBuffer<T, Target>& TypedBuffer<T, Target>::operator=(TypedBuffer&& moved) noexcept
+    {
+        if (this != &moved)
+        {
+            _storage = std::move(moved._storage);
+            _shadow = std::move(moved._shadow);
+            moved._shadow.reset();
+        }
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    bool TypedBuffer<T, Target>::operator==(const TypedBuffer& other) const
+    {
+        return this == &other;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    bool TypedBuffer<T, Target>::operator!=(const TypedBuffer& other) const
+    {
+        return !(*this == other);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::reserve(size_t size)
+    {
+        if (size <= this->size()) return;
+
+        if (_shadow)
+            _shadow->resize(size);
+
+        _storage.reserve(size * sizeof(T));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::update(std::span<const T> data)
+    {
+        update(0, data);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::update(size_t offset, std::span<const T> data)
+    {
+        if (_shadow)
+        {
+            _shadow->write(offset, data);
+            return;
+        }
+
+        _storage.update(offset * sizeof(T), data.data(), data.size() * sizeof(T));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::updateDiscard(std::span<const T> data)
+    {
+        // The whole contents are uploaded right away, so the shadow copy has nothing pending
+        if (_shadow)
+        {
+            _shadow->resize(std::max(_shadow->size(), data.size()));
+            _shadow->write(0, data);
+            _shadow->clearDirty();
+        }
+
+        _storage.updateDiscard(data.data(), data.size() * sizeof(T));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::copyTo(IBufferStorage<T>& buffer) const
+    {
+        auto* typedBuffer = dynamic_cast<TypedBuffer*>(&buffer);
+        if (typedBuffer && !typedBuffer->_shadow)
+        {
+            size_t currentCapacity = this->capacity();
+
+            if (typedBuffer->capacity() < currentCapacity)
+                typedBuffer->reserve(currentCapacity / sizeof(T));
+
+            _storage.copyTo(typedBuffer->_storage, 0, 0, currentCapacity);
+        }
+        else if (size() > 0)
+        {
+            if (buffer.size() < size())
+                buffer.reserve(size());
+
+            ReadScope source(*this);
+            buffer.update(std::span<const T>(source.data(), size()));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::copyRanges(IBufferStorage<T>& buffer, std::span<CopyRegion> regions) const
+    {
+        auto* typedBuffer = dynamic_cast<TypedBuffer*>(&buffer);
+        size_t count = coalesceCopyRegions(regions, size(), buffer.size(), typedBuffer == this);
+        if (count == 0) return;
+
+        if (typedBuffer && !typedBuffer->_shadow)
+        {
+            for (auto& region : regions.first(count))
+            {
+                _storage.copyTo(typedBuffer->_storage, region.srcOffset * sizeof(T),
+                                region.dstOffset * sizeof(T), region.count * sizeof(T));
+            }
+            return;
+        }
+
+        ReadScope source(*this);
+        for (auto& region : regions.first(count))
+        {
+            buffer.update(region.dstOffset, std::span<const T>(source.data() + region.srcOffset, region.count));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    std::vector<T> TypedBuffer<T, Target>::data() const
+    {
+        return data(0, size());
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    std::vector<T> TypedBuffer<T, Target>::data(size_t offset, size_t size) const
+    {
+        std::vector<T> container(size);
+        readInto(container, offset);
+        return container;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::readInto(std::span<T> out, size_t offset) const
+    {
+        if (offset + out.size() > size())
+            throw std::out_of_range("The read range is out of the buffer");
+
+        if (_shadow)
+        {
+            std::copy_n(_shadow->data() + offset, out.size(), out.begin());
+            return;
+        }
+
+        _storage.read(offset * sizeof(T), out.data(), out.size() * sizeof(T));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    AsyncReadback<T> TypedBuffer<T, Target>::readAsync(size_t offset, size_t count) const
+    {
+        if (offset + count > size())
+            throw std::out_of_range("The read range is out of the buffer");
+
+        return AsyncReadback<T>(_storage.getNativeHandle(), offset, count);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    AsyncReadback<T> TypedBuffer<T, Target>::readAsync(ReadbackRing& ring, size_t offset, size_t count) const
+    {
+        if (offset + count > size())
+            throw std::out_of_range("The read range is out of the buffer");
+
+        return ring.template read<T>(_storage.getNativeHandle(), offset, count);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    size_t TypedBuffer<T, Target>::size() const
+    {
+        return capacity() / sizeof(T);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    size_t TypedBuffer<T, Target>::capacity() const
+    {
+        return _storage.capacity();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::enableShadow(size_t mergeGap)
+    {
+        if (_shadow) return;
+
+        _shadow.emplace(data(), mergeGap);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::disableShadow()
+    {
+        flush();
+        _shadow.reset();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    bool TypedBuffer<T, Target>::hasShadow() const
+    {
+        return _shadow.has_value();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::flush()
+    {
+        if (!_shadow || !_shadow->isDirty()) return;
+
+        for (auto& region : _shadow->takeDirtyRegions())
+        {
+            _storage.update(region.offset * sizeof(T), _shadow->data() + region.offset, region.count * sizeof(T));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    ShadowStats TypedBuffer<T, Target>::getShadowStats() const
+    {
+        return _shadow ? _shadow->getStats() : ShadowStats();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::resetShadowStats()
+    {
+        if (_shadow)
+            _shadow->resetStats();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    BufferUsage TypedBuffer<T, Target>::getUsage() const
+    {
+        return _storage.getUsage();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::bind() const
+    {
+        _storage.bind(Target);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::bindBase(unsigned int index) const requires (Target == UniformTarget || Target == ShaderStorageTarget)
+    {
+        _storage.bindBase(Target, index);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::bindRange(unsigned int index, size_t offset, size_t count) const requires (Target == UniformTarget || Target == ShaderStorageTarget)
+    {
+        _storage.bindRange(Target, index, offset * sizeof(T), count * sizeof(T));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::bindStorage(unsigned int index) const
+    {
+        _storage.bindBase(ShaderStorageTarget, index);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::bindStorageRange(unsigned int index, size_t offset, size_t count) const
+    {
+        _storage.bindRange(ShaderStorageTarget, index, offset * sizeof(T), count * sizeof(T));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    unsigned int TypedBuffer<T, Target>::getNativeHandle() const
+    {
+        return _storage.getNativeHandle();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void TypedBuffer<T, Target>::release()
+    {
+        _shadow.reset();
+        _storage.release();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    TypedBuffer<T, Target>::ReadScope::ReadScope(const TypedBuffer& buffer) : _buffer(buffer), _data(nullptr)
+    {
+        // The contents already in the client memory are read directly, otherwise the buffer is mapped
+        // for the duration of the read instead of being copied into a temporary vector
+        if (_buffer._shadow)
+        {
+            _data = _buffer._shadow->data();
+            return;
+        }
+
+        // The persistent mapping cannot be read, so the contents are copied out through the driver
+        if (_buffer._storage.isPersistent())
+        {
+            _copy.resize(_buffer.size());
+            _buffer._storage.read(0, _copy.data(), _copy.size() * sizeof(T));
+            _data = _copy.data();
+            return;
+        }
+
+        // Fails e.g. while the buffer is already mapped by a map context, the destructor then has nothing to unmap
+        _data = static_cast<const T*>(_buffer._storage.mapRead());
+        if (!_data)
+            throw std::logic_error("Failed to map the buffer for reading");
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    TypedBuffer<T, Target>::ReadScope::~ReadScope()
+    {
+        if (!_buffer._shadow && !_buffer._storage.isPersistent())
+            _buffer._storage.unmapRead();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    const T* TypedBuffer<T, Target>::ReadScope::data() const
+    {
+        return _data;
+    }
+}
+
+#endif
@@ -0,0 +1,199 @@
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <glad/glad.h>
+#include "UploadManager.hpp"
+
+namespace bw::low_level
+{
+    // Flags of the immutable storage and its persistent mapping used by the staging ring
+    const GLbitfield um_stagingFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    ////////////////////////////////////////////////////////////
+
+    UploadManager::UploadManager(size_t stagingSize, size_t frameBudget) 
+        : _staging(0), _data(nullptr), _capacity(stagingSize), _head(0), _used(0), _pendingBytes(0), _frameBudget(frameBudget)
+    {
+        glCreateBuffers(1, &_staging);
+        glNamedBufferStorage(_staging, stagingSize, nullptr, um_stagingFlags);
+        _data = static_cast<std::byte*>(glMapNamedBufferRange(_staging, 0, stagingSize, um_stagingFlags));
+
+        if (!_data)
+        {
+            glDeleteBuffers(1, &_staging);
+            throw std::runtime_error("Failed to map the staging buffer");
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    UploadManager::~UploadManager()
+    {
+        release();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    bool UploadManager::upload(VertexBuffer& buffer, size_t offset, std::span<const Vertex> vertices)
+    {
+        _checkDestination(buffer, offset, vertices.size());
+        return _stage(buffer.getNativeHandle(), offset * sizeof(Vertex), vertices.data(), vertices.size_bytes());
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void UploadManager::submit()
+    {
+        std::lock_guard lock(_mutex);
+        _submit(_frameBudget);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void UploadManager::submitAll()
+    {
+        std::lock_guard lock(_mutex);
+        _submit(_pendingBytes);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    size_t UploadManager::getPendingBytes() const
+    {
+        std::lock_guard lock(_mutex);
+        return _pendingBytes;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    size_t UploadManager::getFrameBudget() const
+    {
+        std::lock_guard lock(_mutex);
+        return _frameBudget;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void UploadManager::setFrameBudget(size_t frameBudget)
+    {
+        std::lock_guard lock(_mutex);
+        _frameBudget = frameBudget;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    size_t UploadManager::getStagingSize() const
+    {
+        std::lock_guard lock(_mutex);
+        return _capacity;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    unsigned int UploadManager::getNativeHandle() const
+    {
+        return _staging;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void UploadManager::release()
+    {
+        std::lock_guard lock(_mutex);
+        if (_staging != 0)
+        {
+            glUnmapNamedBuffer(_staging);
+            glDeleteBuffers(1, &_staging);
+            _staging = 0;
+            _data = nullptr;
+            _capacity = 0;
+        }
+        _pending.clear();
+        _retired.clear();
+        _head = 0;
+        _used = 0;
+        _pendingBytes = 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    bool UploadManager::_stage(unsigned int buffer, size_t offset, const void* data, size_t size)
+    {
+        if (size == 0) return true;
+
+        std::lock_guard lock(_mutex);
+        if (_staging == 0)
+            throw std::logic_error("The staging ring has been released");
+
+        if (size > _capacity)
+            throw std::invalid_argument("The data is larger than the staging buffer");
+
+        if (_used + size > _capacity) return false;
+
+        // Each allocation is contiguous, the unused end of the ring is charged to the allocation that wraps around
+        if (_used == 0) _head = 0;
+        size_t tail = (_head + _capacity - _used) % _capacity;
+
+        size_t stagingOffset = _head;
+        size_t ringSize = size;
+        if (_head >= tail && _capacity - _head < size)
+        {
+            if (tail < size) return false;
+
+            stagingOffset = 0;
+            ringSize += _capacity - _head;
+        }
+        else if (_head < tail && tail - _head < size)
+        {
+            return false;
+        }
+
+        std::memcpy(_data + stagingOffset, data, size);
+
+        _head = (stagingOffset + size) % _capacity;
+        _used += ringSize;
+        _pendingBytes += size;
+        _pending.push_back({ buffer, offset, stagingOffset, size, ringSize });
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void UploadManager::_submit(size_t budget)
+    {
+        // The staging memory of the copies the GPU has finished can be reused
+        while (!_retired.empty() && _retired.front().fence.isSignaled())
+        {
+            _used -= _retired.front().ringSize;
+            _retired.pop_front();
+        }
+
+        size_t released = 0;
+        while (!_pending.empty() && budget > 0)
+        {
+            Upload& upload = _pending.front();
+            size_t part = std::min(upload.size, budget);
+
+            glCopyNamedBufferSubData(_staging, upload.buffer, upload.stagingOffset, upload.bufferOffset, part);
+
+            budget -= part;
+            _pendingBytes -= part;
+            upload.size -= part;
+            upload.stagingOffset += part;
+            upload.bufferOffset += part;
+
+            if (upload.size == 0)
+            {
+                released += upload.ringSize;
+                _pending.pop_front();
+            }
+        }
+
+        if (released > 0)
+        {
+            _retired.emplace_back();
+            _retired.back().fence.signal();
+            _retired.back().ringSize = released;
+        }
+    }
+}
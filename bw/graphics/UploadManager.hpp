@@ -0,0 +1,155 @@
+#pragma once
+
+#include <span>
+#include <deque>
+#include <mutex>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include "IResource.hpp"
+#include "GpuFence.hpp"
+#include "VertexBuffer.hpp"
+#include "ElementBuffer.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @class UploadManager
+    /// @brief Streams data into static buffers through a persistently mapped staging ring
+    /// 
+    /// Producers on any thread copy their data into the staging ring with upload(), which never calls OpenGL.
+    /// Once per frame the GL thread calls submit(), which issues GPU-side copies into the destination buffers
+    /// until the byte budget of the frame is spent. The staging memory is reused after the GPU finishes the copies,
+    /// so loading is spread over frames instead of stalling one of them.
+    /// 
+    /// @implements IResource<unsigned int>
+    ///
+    class UploadManager : public IResource<unsigned int>
+    {
+    public:
+        /// @brief Default size of the staging ring in bytes
+        static constexpr size_t DefaultStagingSize = 16 * 1024 * 1024;
+
+        /// @brief Default number of bytes copied per frame
+        static constexpr size_t DefaultFrameBudget = 4 * 1024 * 1024;
+
+        /// @brief Creates and persistently maps the staging ring
+        /// @param stagingSize Size of the staging ring in bytes
+        /// @param frameBudget Maximum number of bytes copied by one submit()
+        /// @throw std::runtime_error If the staging ring cannot be mapped
+        UploadManager(size_t stagingSize = DefaultStagingSize, size_t frameBudget = DefaultFrameBudget);
+
+        UploadManager(const UploadManager&) = delete;
+        UploadManager& operator=(const UploadManager&) = delete;
+
+        ~UploadManager();
+
+        /// @brief Stages the vertices for the upload. Safe to call from any thread
+        /// @param buffer Destination buffer, must stay alive until the data is submitted. Its size and shadow state are checked
+        /// on the calling thread, so it must not be resized, released or get a shadow copy while uploads to it are pending
+        /// @param offset Index of the first destination vertex
+        /// @param vertices Data to upload
+        /// @return True if staged, false if the staging ring is full (retry after the next submit)
+        /// @throw std::invalid_argument If the buffer has a shadow copy (the GPU-side copy would bypass it)
+        /// @throw std::out_of_range If the destination range is out of the buffer
+        /// @throw std::invalid_argument If the data is larger than the staging ring
+        /// @throw std::logic_error If the staging ring has been released
+        bool upload(VertexBuffer& buffer, size_t offset, std::span<const Vertex> vertices);
+
+        /// @brief Stages the indices for the upload. Safe to call from any thread
+        /// @param buffer Destination buffer, must stay alive until the data is submitted. Its size and shadow state are checked
+        /// on the calling thread, so it must not be resized, released or get a shadow copy while uploads to it are pending
+        /// @param offset Index of the first destination index
+        /// @param indices Data to upload
+        /// @return True if staged, false if the staging ring is full (retry after the next submit)
+        /// @throw std::invalid_argument If the buffer has a shadow copy (the GPU-side copy would bypass it)
+        /// @throw std::out_of_range If the destination range is out of the buffer
+        /// @throw std::invalid_argument If the data is larger than the staging ring
+        /// @throw std::logic_error If the staging ring has been released
+        template <typename TIndex>
+        bool upload(BasicElementBuffer<TIndex>& buffer, size_t offset, std::type_identity_t<std::span<const TIndex>> indices);
+
+        /// @brief Copies the staged data into the destination buffers within the frame budget. Called on the GL thread once per frame
+        void submit();
+
+        /// @brief Copies all staged data ignoring the frame budget, e.g. behind a loading screen
+        void submitAll();
+
+        /// @brief Gets the number of staged bytes waiting for submit()
+        /// @return Pending bytes
+        size_t getPendingBytes() const;
+
+        /// @brief Gets the maximum number of bytes copied by one submit()
+        /// @return Frame budget in bytes
+        size_t getFrameBudget() const;
+
+        /// @brief Sets the maximum number of bytes copied by one submit()
+        /// @param frameBudget Frame budget in bytes
+        void setFrameBudget(size_t frameBudget);
+
+        /// @brief Gets the size of the staging ring
+        /// @return Staging size in bytes
+        size_t getStagingSize() const;
+
+        /// @brief Gets the staging buffer native handle
+        /// @return OpenGL buffer handle
+        unsigned int getNativeHandle() const override;
+
+        /// @brief Releases the staging ring, the pending data is dropped
+        void release() override;
+    private:
+        struct Upload
+        {
+            unsigned int buffer;
+            size_t bufferOffset;
+            size_t stagingOffset;
+            size_t size;
+            size_t ringSize;
+        };
+
+        struct Retired
+        {
+            GpuFence fence;
+            size_t ringSize;
+        };
+
+        unsigned int _staging;
+        std::byte* _data;
+        size_t _capacity;
+        size_t _head;
+        size_t _used;
+        size_t _pendingBytes;
+        size_t _frameBudget;
+
+        std::deque<Upload> _pending;
+        std::deque<Retired> _retired;
+        mutable std::mutex _mutex;
+
+        bool _stage(unsigned int buffer, size_t offset, const void* data, size_t size);
+        void _submit(size_t budget);
+
+        template <typename T, BufferTarget Target>
+        static void _checkDestination(const TypedBuffer<T, Target>& buffer, size_t offset, size_t count);
+    };
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TIndex>
+    bool UploadManager::upload(BasicElementBuffer<TIndex>& buffer, size_t offset, std::type_identity_t<std::span<const TIndex>> indices)
+    {
+        _checkDestination(buffer, offset, indices.size());
+        return _stage(buffer.getNativeHandle(), offset * sizeof(TIndex), indices.data(), indices.size_bytes());
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T, BufferTarget Target>
+    void UploadManager::_checkDestination(const TypedBuffer<T, Target>& buffer, size_t offset, size_t count)
+    {
+        if (buffer.hasShadow())
+            throw std::invalid_argument("Uploads write the GPU memory directly and cannot update the shadow copy");
+
+        if (offset + count > buffer.size())
+            throw std::out_of_range("The upload range is out of the buffer");
+    }
+}
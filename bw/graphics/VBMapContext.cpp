@@ -10,13 +10,34 @@ namespace bw::low_level
         {
             case MapAccess::ReadOnly:  return GL_READ_ONLY;
             case MapAccess::WriteOnly: return GL_WRITE_ONLY;
-            default:                   return GL_NONE;
+            default:                   return GL_READ_WRITE;
         }
     }
 
 	////////////////////////////////////////////////////////////
 
-    VBMapContext::VBMapContext(VertexBuffer& buffer) : _buffer(&buffer) { }
+    GLbitfield vb_mapRangeToGLbitfield(MapAccess access, unsigned int flags)
+    {
+        GLbitfield bits = 0;
+
+        switch(access)
+        {
+            case MapAccess::ReadOnly:  bits = GL_MAP_READ_BIT; break;
+            case MapAccess::WriteOnly: bits = GL_MAP_WRITE_BIT; break;
+            default:                   bits = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT; break;
+        }
+
+        if(flags & MapFlags::InvalidateRange)  bits |= GL_MAP_INVALIDATE_RANGE_BIT;
+        if(flags & MapFlags::InvalidateBuffer) bits |= GL_MAP_INVALIDATE_BUFFER_BIT;
+        if(flags & MapFlags::Unsynchronized)   bits |= GL_MAP_UNSYNCHRONIZED_BIT;
+        if(flags & MapFlags::FlushExplicit)    bits |= GL_MAP_FLUSH_EXPLICIT_BIT;
+
+        return bits;
+    }
+
+	////////////////////////////////////////////////////////////
+
+    VBMapContext::VBMapContext(VertexBuffer& buffer) : _buffer(&buffer), _data(nullptr), _mapped(false), _count(0) { }
     
 	////////////////////////////////////////////////////////////
 
@@ -24,9 +45,13 @@ namespace bw::low_level
     {   
         this->_buffer = moved._buffer;
         this->_data = moved._data;
+        this->_mapped = moved._mapped;
+        this->_count = moved._count;
 
         moved._buffer = nullptr;
         moved._data = nullptr;
+        moved._mapped = false;
+        moved._count = 0;
     }
 
 	////////////////////////////////////////////////////////////
@@ -44,9 +69,13 @@ namespace bw::low_level
 
         this->_buffer = moved._buffer;
         this->_data = moved._data;
+        this->_mapped = moved._mapped;
+        this->_count = moved._count;
 
         moved._buffer = nullptr;
         moved._data = nullptr;
+        moved._mapped = false;
+        moved._count = 0;
 
         return *this;
     }
@@ -69,27 +98,53 @@ namespace bw::low_level
 
     void VBMapContext::map(MapAccess access)
     {
-        if(!isMapped())
+        if(!_mapped)
+        {
             _data = static_cast<Vertex*>(glMapNamedBuffer(_buffer->getNativeHandle(), vb_mapAccessToGLenum(access)));
+            _mapped = _data != nullptr;
+            _count = _buffer->size();
+        }
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void VBMapContext::mapRange(size_t offset, size_t count, MapAccess access, unsigned int flags)
+    {
+        if(!_mapped)
+        {
+            _data = static_cast<Vertex*>(glMapNamedBufferRange(_buffer->getNativeHandle(), offset * sizeof(Vertex), 
+                                                               count * sizeof(Vertex), vb_mapRangeToGLbitfield(access, flags)));
+            _mapped = _data != nullptr;
+            _count = count;
+        }
+    }
+
+	////////////////////////////////////////////////////////////
+
+    void VBMapContext::flushRange(size_t offset, size_t count)
+    {
+        if(_mapped)
+            glFlushMappedNamedBufferRange(_buffer->getNativeHandle(), offset * sizeof(Vertex), count * sizeof(Vertex));
     }
     
 	////////////////////////////////////////////////////////////
 
     void VBMapContext::unmap()
     {
-        if(isMapped())
+        if(_mapped)
+        {
             glUnmapNamedBuffer(_buffer->getNativeHandle());
+            _data = nullptr;
+            _mapped = false;
+            _count = 0;
+        }
     }
     
 	////////////////////////////////////////////////////////////
 
     bool VBMapContext::isMapped() const
     {
-        int mapped;
-
-        glGetNamedBufferParameteriv(_buffer->getNativeHandle(), GL_BUFFER_MAPPED, &mapped);
-    
-        return mapped;
+        return _mapped;
     }
     
 	////////////////////////////////////////////////////////////
@@ -105,9 +160,26 @@ namespace bw::low_level
     {
         if(!_data) return std::nullopt;
 
-        int n = _buffer->size();
-        if(index < 0 || index >= n) return std::nullopt;
+        if(index < 0 || static_cast<size_t>(index) >= _count) return std::nullopt;
 
         return _data + index;
     }
+
+	////////////////////////////////////////////////////////////
+
+    std::span<Vertex> VBMapContext::span()
+    {
+        if(!_mapped) return {};
+
+        return { _data, _count };
+    }
+
+	////////////////////////////////////////////////////////////
+
+    std::span<const Vertex> VBMapContext::span() const
+    {
+        if(!_mapped) return {};
+
+        return { _data, _count };
+    }
 }
@@ -31,10 +31,23 @@ namespace bw::low_level
         /// @brief Maps the buffer to make it accessible if it not mapped yet
         void map(MapAccess access) override;
 
+        /// @brief Maps the range of the buffer to make it accessible if it not mapped yet.
+        /// Indices of the context become relative to the beginning of the range
+        /// @param offset Index of the first mapped vertex
+        /// @param count Number of mapped vertices
+        /// @param access Access mode
+        /// @param flags Combination of MapFlags
+        void mapRange(size_t offset, size_t count, MapAccess access, unsigned int flags = 0) override;
+
+        /// @brief Flushes the modified part of the mapped range. Requires MapFlags::FlushExplicit
+        /// @param offset Index of the first modified vertex relative to the mapped range
+        /// @param count Number of modified vertices
+        void flushRange(size_t offset, size_t count) override;
+
         /// @brief Unmaps the buffer if it mapped
         void unmap() override;
 
-        /// @brief Get map status
+        /// @brief Get map status. The status is tracked by the context and does not query the driver
         /// @return True if mapped, otherwise false
         bool isMapped() const override;
 
@@ -47,8 +60,18 @@ namespace bw::low_level
         /// @param index The vertex's index
         /// @return Correct buffer vertex or none
         std::optional<Vertex*> tryGet(int index) override;
+
+        /// @brief Get the mapped vertices as a contiguous span. Only work with the enabled mapping
+        /// @return Mapped vertices (empty if the buffer is not mapped)
+        std::span<Vertex> span() override;
+
+        /// @brief Get the mapped vertices as a contiguous span. Only work with the enabled mapping
+        /// @return Mapped vertices (empty if the buffer is not mapped)
+        std::span<const Vertex> span() const override;
     private:
         VertexBuffer* _buffer;
         Vertex* _data;
+        bool _mapped;
+        size_t _count;
     };
 }
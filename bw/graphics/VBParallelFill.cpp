@@ -0,0 +1,151 @@
+#include <thread>
+#include <vector>
+#include <exception>
+#include <algorithm>
+#include <stdexcept>
+#include "VBParallelFill.hpp"
+#include "VertexBuffer.hpp"
+
+namespace bw::low_level
+{
+    VBParallelFill::VBParallelFill(VertexBuffer& buffer, size_t offset, size_t count, size_t chunkCount) 
+        : _context(buffer), _chunkCount(std::max<size_t>(chunkCount, 1)), 
+          _taken(_chunkCount, false), _takenCount(0), _arrived(0), _finished(false)
+    {
+        if (buffer.hasShadow())
+            throw std::invalid_argument("Parallel fill writes the GPU memory directly and cannot update the shadow copy");
+
+        if (buffer.isStreaming())
+        {
+            std::span<Vertex> frame = buffer.getFrame();
+            if (offset + count > frame.size())
+                throw std::out_of_range("The range does not fit into the stream frame");
+
+            _range = frame.subspan(offset, count);
+            return;
+        }
+
+        if (offset + count > buffer.size())
+            throw std::out_of_range("The range is out of the vertex buffer");
+
+        if (count > 0)
+        {
+            // The previous contents of the range are discarded, so the driver does not have to synchronize
+            _context.mapRange(offset, count, MapAccess::WriteOnly, MapFlags::InvalidateRange);
+            if (!_context.isMapped())
+                throw std::runtime_error("Failed to map the vertex buffer range for the parallel fill");
+
+            _range = _context.span();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    VBParallelFill::~VBParallelFill()
+    {
+        if (_finished) return;
+
+        _wait(true);
+        _context.unmap();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    std::span<Vertex> VBParallelFill::getChunk(size_t index) const
+    {
+        if (index >= _chunkCount)
+            throw std::out_of_range("Chunk index is out of the chunk count");
+
+        {
+            std::lock_guard lock(_mutex);
+            if (!_taken[index])
+            {
+                _taken[index] = true;
+                _takenCount++;
+            }
+        }
+
+        size_t base = _range.size() / _chunkCount;
+        size_t remainder = _range.size() % _chunkCount;
+
+        // The first chunks take one extra vertex each
+        size_t offset = index * base + std::min(index, remainder);
+        size_t count = base + (index < remainder ? 1 : 0);
+
+        return _range.subspan(offset, count);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    size_t VBParallelFill::getChunkCount() const
+    {
+        return _chunkCount;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void VBParallelFill::arrive()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _arrived++;
+        }
+        _arrival.notify_all();
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void VBParallelFill::run(const std::function<void(std::span<Vertex>, size_t)>& worker)
+    {
+        std::exception_ptr error;
+        std::mutex errorMutex;
+
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(_chunkCount);
+
+            for (size_t i = 0; i < _chunkCount; i++)
+            {
+                threads.emplace_back([this, &worker, &error, &errorMutex, i]() {
+                    // An exception escaping the thread would terminate the process, so it is passed to the caller
+                    try
+                    {
+                        worker(getChunk(i), i);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lock(errorMutex);
+                        if (!error)
+                            error = std::current_exception();
+                    }
+                    arrive();
+                });
+            }
+        }
+        finish();
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void VBParallelFill::finish()
+    {
+        if (_finished) return;
+
+        _wait(false);
+        _context.unmap();
+        _finished = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void VBParallelFill::_wait(bool takenOnly)
+    {
+        std::unique_lock lock(_mutex);
+        _arrival.wait(lock, [this, takenOnly]() {
+            return _arrived >= (takenOnly ? _takenCount : _chunkCount);
+        });
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <span>
+#include <mutex>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+#include "VBMapContext.hpp"
+#include "Vertex.hpp"
+
+namespace bw::low_level
+{
+    class VertexBuffer;
+
+    ///
+    /// @class VBParallelFill
+    /// @brief Maps the range of the vertex buffer on the GL thread and splits it into disjoint chunks
+    /// that worker threads fill directly in the mapped memory
+    /// 
+    /// The context is created and finished on the GL thread. Each worker writes only its own chunk
+    /// and calls arrive() when it is done, finish() waits for all chunks before unmapping the buffer,
+    /// so the buffer can be drawn right after it. For the stream ring the current frame is used
+    /// without mapping, the range is relative to the frame.
+    ///
+    class VBParallelFill
+    {
+    public:
+        /// @brief Maps the range of the buffer for writing and splits it into chunks
+        /// @param buffer Vertex buffer to fill (must not have a shadow copy)
+        /// @param offset Index of the first vertex of the range
+        /// @param count Number of vertices in the range
+        /// @param chunkCount Number of chunks, usually the number of the workers
+        /// @throw std::invalid_argument If the buffer has a shadow copy
+        /// @throw std::out_of_range If the range is out of the buffer
+        /// @throw std::runtime_error If the buffer cannot be mapped (e.g. it is already mapped)
+        VBParallelFill(VertexBuffer& buffer, size_t offset, size_t count, size_t chunkCount);
+
+        VBParallelFill(const VBParallelFill&) = delete;
+        VBParallelFill& operator=(const VBParallelFill&) = delete;
+
+        /// @brief Finishes the fill if finish() was not called. Waits only for the chunks taken by getChunk(),
+        /// so a fill abandoned before the workers were started (e.g. by an exception) does not block forever.
+        /// The contents of the chunks that were not taken are undefined
+        ~VBParallelFill();
+
+        /// @brief Gets the writable memory of the chunk. Safe to call from any thread
+        /// @param index Chunk index
+        /// @return Disjoint part of the mapped range (sizes differ by one vertex at most)
+        /// @throw std::out_of_range If the index is not less than the chunk count
+        std::span<Vertex> getChunk(size_t index) const;
+
+        /// @brief Gets the number of chunks
+        /// @return Chunk count
+        size_t getChunkCount() const;
+
+        /// @brief Signals that the chunk is filled. Called once per chunk from the worker thread
+        void arrive();
+
+        /// @brief Fills every chunk on its own thread and waits for them, then unmaps the buffer
+        /// @param worker Function that fills the chunk, receives the chunk memory and its index
+        /// @throw Rethrows the first exception thrown by the workers after all of them are done
+        void run(const std::function<void(std::span<Vertex>, size_t)>& worker);
+
+        /// @brief Waits for all chunks and unmaps the buffer. Must be called on the GL thread before drawing
+        void finish();
+    private:
+        VBMapContext _context;
+        std::span<Vertex> _range;
+        size_t _chunkCount;
+        mutable std::mutex _mutex;
+        std::condition_variable _arrival;
+        mutable std::vector<bool> _taken;
+        mutable size_t _takenCount;
+        size_t _arrived;
+        bool _finished;
+
+        void _wait(bool takenOnly);
+    };
+}
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include "math/Vec3.hpp"
 #include "math/Vec4.hpp"
+#include "VertexLayout.hpp"
 
 namespace bw::low_level
 {
@@ -15,4 +17,14 @@ namespace bw::low_level
 		Vertex(Vec3f position, Vec4f color) : position(position), color(color) { }
 		Vertex() : Vertex({ 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 }) {}
 	};
+
+	template <>
+	struct VertexLayout<Vertex>
+	{
+		static constexpr std::array Attributes = {
+			makeAttribute<Vec3f>(0, offsetof(Vertex, position)), // Position (location = 0)
+			makeAttribute<Vec4f>(1, offsetof(Vertex, color)),    // Color (location = 1)
+			makeAttribute<Vec4f>(2, offsetof(Vertex, texture))   // Texture coordinates (location = 2)
+		};
+	};
 }
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <stdexcept>
 #include <glad/glad.h>
 #include "VertexArray.hpp"
 #include "VertexBuffer.hpp"
@@ -5,41 +7,35 @@
 
 namespace bw::low_level
 {
-    VertexArray::VertexArray() : _handle(NullVertexArray), _vertexBuffer(nullptr), _range({0, 0})
+    VertexArray::VertexArray() : _handle(NullVertexArray), _range(0, 0), _elementBuffer(0), _indexType(0), _elementRange(0, 0)
     {
         glCreateVertexArrays(1, &_handle);
     }
 
     ////////////////////////////////////////////////////////////
 
-    VertexArray::VertexArray(VertexBuffer& buffer, Range range) : _handle(NullVertexArray), _vertexBuffer(&buffer), _range(range)
+    VertexArray::VertexArray(const VertexArray& other) : VertexArray()
     {
-        glCreateVertexArrays(1, &_handle);
-        bindTo(buffer, range);
-    }
-    
-    ////////////////////////////////////////////////////////////
-
-    VertexArray::VertexArray(VertexBuffer& buffer) : VertexArray(buffer, { 0, buffer.size() }) 
-    { }
-    
-    ////////////////////////////////////////////////////////////
-
-    VertexArray::VertexArray(const VertexArray& other) : _handle(NullVertexArray), _vertexBuffer(nullptr), _range({0, 0})
-    {
-        glCreateVertexArrays(1, &_handle);
-        if(other._vertexBuffer) {
-            this->bindTo(*other._vertexBuffer, other._range);
+        for(auto& stream : other._streams) {
+            this->_bindStream(stream);
+        }
+        _range = other._range;
+        if(other.hasElements()) {
+            this->_bindElements(other._elementBuffer, other._indexType, other._elementRange);
         }
     }
 
     ////////////////////////////////////////////////////////////
 
-    VertexArray::VertexArray(VertexArray&& moved) noexcept : _handle(moved._handle), _vertexBuffer(moved._vertexBuffer), _range(moved._range)
+    VertexArray::VertexArray(VertexArray&& moved) noexcept : _handle(moved._handle), _streams(std::move(moved._streams)),
+        _range(moved._range), _elementBuffer(moved._elementBuffer), _indexType(moved._indexType), _elementRange(moved._elementRange)
     {
         moved._handle = NullVertexArray;
-        moved._vertexBuffer = nullptr;
+        moved._streams.clear();
         moved._range = {0, 0};
+        moved._elementBuffer = 0;
+        moved._indexType = 0;
+        moved._elementRange = {0, 0};
     }
     
     ////////////////////////////////////////////////////////////
@@ -54,7 +50,20 @@ namespace bw::low_level
     VertexArray& VertexArray::operator=(const VertexArray& other)
     {
         if (this != &other) {
-            this->bindTo(*other._vertexBuffer, other._range);
+            // Streams that the other array lacks must not stay bound
+            while(!_streams.empty()) {
+                this->unbindStream(_streams.back().binding);
+            }
+            for(auto& stream : other._streams) {
+                this->_bindStream(stream);
+            }
+            _range = other._range;
+            if(other.hasElements()) {
+                this->_bindElements(other._elementBuffer, other._indexType, other._elementRange);
+            }
+            else if(this->hasElements()) {
+                this->_bindElements(0, 0, Range(0, 0));
+            }
         }
         return *this;
     }
@@ -68,12 +77,18 @@ namespace bw::low_level
             release();
             
             _handle = moved._handle;
-            _vertexBuffer = moved._vertexBuffer;
+            _streams = std::move(moved._streams);
             _range = moved._range;
+            _elementBuffer = moved._elementBuffer;
+            _indexType = moved._indexType;
+            _elementRange = moved._elementRange;
             
             moved._handle = NullVertexArray;
-            moved._vertexBuffer = nullptr;
+            moved._streams.clear();
             moved._range = {0, 0};
+            moved._elementBuffer = 0;
+            moved._indexType = 0;
+            moved._elementRange = {0, 0};
         }
         return *this;
     }
@@ -94,49 +109,77 @@ namespace bw::low_level
     
     ////////////////////////////////////////////////////////////
 
-    void VertexArray::bindTo(VertexBuffer& buffer)
+    void VertexArray::setDivisor(unsigned int binding, unsigned int divisor)
     {
-        bindTo(buffer, {0, buffer.size()});
+        auto stream = std::ranges::find(_streams, binding, &Stream::binding);
+        if (stream == _streams.end())
+            throw std::invalid_argument("No stream is bound to the binding point");
+
+        stream->divisor = divisor;
+        glVertexArrayBindingDivisor(_handle, binding, divisor);
     }
-    
+
     ////////////////////////////////////////////////////////////
 
-    void VertexArray::bindTo(VertexBuffer& buffer, Range range)
+    void VertexArray::unbindStream(unsigned int binding)
     {
-        _vertexBuffer = &buffer;
-        _range = range;
+        auto stream = std::ranges::find(_streams, binding, &Stream::binding);
+        if (stream == _streams.end()) return;
 
-        const int bindingIndex = 0;
-        const int stride = sizeof(Vertex);
-        const size_t offset = range.start * stride;
+        for (auto& attribute : stream->attributes)
+            glDisableVertexArrayAttrib(_handle, attribute.location);
 
-        glVertexArrayVertexBuffer(_handle, bindingIndex, buffer.getNativeHandle(), offset, sizeof(Vertex));
+        glVertexArrayVertexBuffer(_handle, binding, 0, 0, 0);
+        _streams.erase(stream);
+    }
 
-        // Position (location = 0)
-        glVertexArrayAttribFormat(_handle, 0, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, position));
-        glVertexArrayAttribBinding(_handle, 0, bindingIndex);
-        glEnableVertexArrayAttrib(_handle, 0);
+    ////////////////////////////////////////////////////////////
 
-        // Color (location = 1)
-        glVertexArrayAttribFormat(_handle, 1, 4, GL_FLOAT, GL_FALSE, offsetof(Vertex, color));
-        glVertexArrayAttribBinding(_handle, 1, bindingIndex);
-        glEnableVertexArrayAttrib(_handle, 1);
+    const std::vector<VertexArray::Stream>& VertexArray::getStreams() const
+    {
+        return _streams;
+    }
 
-        // Texture coordinates (location = 2)
-        glVertexArrayAttribFormat(_handle, 2, 4, GL_FLOAT, GL_FALSE, offsetof(Vertex, texture));
-        glVertexArrayAttribBinding(_handle, 2, bindingIndex);
-        glEnableVertexArrayAttrib(_handle, 2);
+    ////////////////////////////////////////////////////////////
+
+    void VertexArray::setRange(Range range)
+    {
+        _range = range;
     }
 
     ////////////////////////////////////////////////////////////
 
     VertexBuffer* VertexArray::getCurrentVertexBuffer()
     {
-        return _vertexBuffer;
+        const Stream* stream = _findStream(0);
+        return stream ? dynamic_cast<VertexBuffer*>(stream->buffer) : nullptr;
+    }
+    
+    ////////////////////////////////////////////////////////////
+
+    std::span<const VertexAttribute> VertexArray::getLayout() const
+    {
+        const Stream* stream = _findStream(0);
+        return stream ? std::span<const VertexAttribute>(stream->attributes) : std::span<const VertexAttribute>();
     }
     
     ////////////////////////////////////////////////////////////
 
+    size_t VertexArray::getStride() const
+    {
+        const Stream* stream = _findStream(0);
+        return stream ? stream->stride : 0;
+    }
+    
+    ////////////////////////////////////////////////////////////
+
+    bool VertexArray::hasElements() const
+    {
+        return _elementBuffer != 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+
     VertexArray::Range VertexArray::getRange() const
     {
         return _range;
@@ -144,6 +187,20 @@ namespace bw::low_level
     
     ////////////////////////////////////////////////////////////
 
+    VertexArray::Range VertexArray::getElementRange() const
+    {
+        return _elementRange;
+    }
+    
+    ////////////////////////////////////////////////////////////
+
+    unsigned int VertexArray::getIndexType() const
+    {
+        return _indexType;
+    }
+    
+    ////////////////////////////////////////////////////////////
+
     unsigned int VertexArray::getNativeHandle() const
     {
         return _handle;
@@ -158,7 +215,80 @@ namespace bw::low_level
             glDeleteVertexArrays(1, &_handle);
             _handle = NullVertexArray;
         }
-        _vertexBuffer = nullptr;
+        _streams.clear();
         _range = {0, 0};
+        _elementBuffer = 0;
+        _indexType = 0;
+        _elementRange = {0, 0};
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    const VertexArray::Stream* VertexArray::_findStream(unsigned int binding) const
+    {
+        auto stream = std::ranges::find(_streams, binding, &Stream::binding);
+        return stream != _streams.end() ? &*stream : nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void VertexArray::_bindStream(Stream stream)
+    {
+        auto reads = [&](const VertexAttribute& attribute) {
+            return std::ranges::any_of(stream.attributes, [&](const VertexAttribute& other) { return other.location == attribute.location; });
+        };
+
+        for (auto& other : _streams)
+        {
+            // Attributes of the previous buffer on this binding that the new one does not have would read garbage
+            if (other.binding == stream.binding)
+            {
+                for (auto& attribute : other.attributes)
+                {
+                    if (!reads(attribute))
+                        glDisableVertexArrayAttrib(_handle, attribute.location);
+                }
+            }
+            // A location reads from one binding only, so it moves to the new stream
+            else
+            {
+                std::erase_if(other.attributes, reads);
+            }
+        }
+
+        // The buffer is bound from the stream offset, the range start is applied by the draw calls
+        // as the first vertex (or the base vertex for indexed drawing)
+        glVertexArrayVertexBuffer(_handle, stream.binding, stream.buffer->getNativeHandle(), 
+                                  static_cast<GLintptr>(stream.offset), static_cast<GLsizei>(stream.stride));
+        glVertexArrayBindingDivisor(_handle, stream.binding, stream.divisor);
+
+        for (auto& attribute : stream.attributes)
+        {
+            if (attribute.integer)
+                glVertexArrayAttribIFormat(_handle, attribute.location, attribute.components, attribute.type, static_cast<GLuint>(attribute.offset));
+            else
+                glVertexArrayAttribFormat(_handle, attribute.location, attribute.components, attribute.type, 
+                                          attribute.normalized ? GL_TRUE : GL_FALSE, static_cast<GLuint>(attribute.offset));
+
+            glVertexArrayAttribBinding(_handle, attribute.location, stream.binding);
+            glEnableVertexArrayAttrib(_handle, attribute.location);
+        }
+
+        auto position = std::ranges::lower_bound(_streams, stream.binding, {}, &Stream::binding);
+        if (position != _streams.end() && position->binding == stream.binding)
+            *position = std::move(stream);
+        else
+            _streams.insert(position, std::move(stream));
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    void VertexArray::_bindElements(unsigned int handle, unsigned int indexType, Range range)
+    {
+        _elementBuffer = handle;
+        _indexType = indexType;
+        _elementRange = range;
+
+        glVertexArrayElementBuffer(_handle, handle);
     }
 }
@@ -1,17 +1,20 @@
 #pragma once
 
+#include <span>
 #include <vector>
 #include "IResource.hpp"
+#include "VertexBuffer.hpp"
+#include "ElementBuffer.hpp"
+#include "BufferSlice.hpp"
+#include "VertexLayout.hpp"
 #include "Vertex.hpp"
 
 namespace bw::low_level
 {
-    class VertexBuffer;
-    class ElementBuffer;
-
     ///
     /// @class VertexArray
-    /// @brief Class that wraps the functionality of vertex arrays in the OpenGL API
+    /// @brief Class that wraps the functionality of vertex arrays in the OpenGL API.
+    /// Attribute formats are set up from the VertexLayout of the bound vertex type
     /// @implements IResource<unsigned int>
     ///
     class VertexArray : public IResource<unsigned int>
@@ -29,9 +32,31 @@ namespace bw::low_level
             size_t count;
 
             Range(size_t start, size_t count) : start(start), count(count) { }
+            /// @brief Converts the slice of the shared buffer to the range, so slices can be bound directly
+            Range(BufferSlice slice) : Range(slice.offset, slice.count) { }
             Range() : Range(0, 0) { }
         };
 
+        ///
+        /// @struct Stream
+        /// @brief Structure representing the vertex buffer bound to one binding point and the attributes read from it
+        ///
+        struct Stream
+        {
+            /// @brief Binding point index
+            unsigned int binding;
+            /// @brief Bound buffer
+            IResource<unsigned int>* buffer;
+            /// @brief Distance between the elements in bytes
+            size_t stride;
+            /// @brief Offset of the first element in the buffer in bytes
+            size_t offset;
+            /// @brief Number of instances that share one element (0 for per-vertex data)
+            unsigned int divisor;
+            /// @brief Attributes read from the buffer
+            std::vector<VertexAttribute> attributes;
+        };
+
         /// @brief Constant for a non-existent vertex array
         static const unsigned int NullVertexArray = 0;
 
@@ -41,11 +66,13 @@ namespace bw::low_level
         /// @brief Creates and initializes vertex array and binds vertex buffer with range
         /// @param buffer Vertex buffer to bind
         /// @param range Available range of vertices
-        VertexArray(VertexBuffer& buffer, Range range);
+        template <LayoutVertex TVertex>
+        VertexArray(BasicVertexBuffer<TVertex>& buffer, Range range);
         
         /// @brief Creates and initializes vertex array and binds vertex buffer
         /// @param buffer Vertex buffer to bind
-        VertexArray(VertexBuffer& buffer);
+        template <LayoutVertex TVertex>
+        VertexArray(BasicVertexBuffer<TVertex>& buffer);
 
         VertexArray(const VertexArray& other);
         VertexArray(VertexArray&& moved) noexcept;
@@ -58,23 +85,112 @@ namespace bw::low_level
         bool operator==(const VertexArray& other);
         bool operator!=(const VertexArray& other);
 
-        /// @brief Binds vertex array to vertex buffer
+        /// @brief Binds vertex array to vertex buffer and sets up the attributes of its vertex type.
+        /// Attributes of the previous layout that the new one does not have are disabled
+        /// @param buffer Vertex buffer to bind
+        template <LayoutVertex TVertex>
+        void bindTo(BasicVertexBuffer<TVertex>& buffer);
+
+        /// @brief Binds vertex array to vertex buffer with range and sets up the attributes of its vertex type
+        /// @param buffer Vertex buffer to bind
+        /// @param range Available range of vertices
+        template <LayoutVertex TVertex>
+        void bindTo(BasicVertexBuffer<TVertex>& buffer, Range range);
+
+        /// @brief Binds the buffer to the binding point as a separate stream, the attributes of its vertex type read from it.
+        /// Several streams let the data that changes every frame live in its own buffer (structure of arrays)
+        /// @param binding Binding point index (0 is used by bindTo)
         /// @param buffer Vertex buffer to bind
-        void bindTo(VertexBuffer& buffer);
+        /// @param offset Index of the first element of the stream
+        /// @param divisor Number of instances that share one element (0 for per-vertex data)
+        template <LayoutVertex TVertex>
+        void bindStream(unsigned int binding, BasicVertexBuffer<TVertex>& buffer, size_t offset = 0, unsigned int divisor = 0);
 
-        /// @brief Binds vertex array to vertex buffer with range
+        /// @brief Binds the buffer to the binding point as a separate stream with the explicit attributes.
+        /// Attribute offsets are relative to the element of the buffer
+        /// @param binding Binding point index (0 is used by bindTo)
         /// @param buffer Vertex buffer to bind
+        /// @param attributes Attributes read from the buffer
+        /// @param offset Index of the first element of the stream
+        /// @param divisor Number of instances that share one element (0 for per-vertex data)
+        template <typename T>
+        void bindStream(unsigned int binding, BasicVertexBuffer<T>& buffer, std::span<const VertexAttribute> attributes, 
+                        size_t offset = 0, unsigned int divisor = 0);
+
+        /// @brief Binds the buffer of single attribute values (e.g. only positions) to the binding point as a separate stream
+        /// @param binding Binding point index (0 is used by bindTo)
+        /// @param buffer Vertex buffer to bind
+        /// @param attribute Attribute read from the buffer
+        /// @param offset Index of the first element of the stream
+        /// @param divisor Number of instances that share one element (0 for per-vertex data)
+        template <typename T>
+        void bindStream(unsigned int binding, BasicVertexBuffer<T>& buffer, const VertexAttribute& attribute, 
+                        size_t offset = 0, unsigned int divisor = 0);
+
+        /// @brief Binds the buffer of per-instance data (e.g. transforms and colors of the sprites) to the binding point.
+        /// The attributes of its vertex type advance once per `divisor` instances of the instanced draw calls
+        /// @param binding Binding point index (0 is used by bindTo)
+        /// @param buffer Buffer of the instance data
+        /// @param divisor Number of instances that share one element
+        template <LayoutVertex TInstance>
+        void bindInstances(unsigned int binding, BasicVertexBuffer<TInstance>& buffer, unsigned int divisor = 1);
+
+        /// @brief Changes the number of instances that share one element of the stream
+        /// @param binding Binding point index of the bound stream
+        /// @param divisor Number of instances that share one element (0 for per-vertex data)
+        void setDivisor(unsigned int binding, unsigned int divisor);
+
+        /// @brief Detaches the buffer from the binding point and disables its attributes
+        /// @param binding Binding point index
+        void unbindStream(unsigned int binding);
+
+        /// @brief Gets the streams bound to the vertex array
+        /// @return Streams sorted by the binding point
+        const std::vector<Stream>& getStreams() const;
+
+        /// @brief Sets the range of vertices used by the draw calls, e.g. when the vertex array only has streams
         /// @param range Available range of vertices
-        void bindTo(VertexBuffer& buffer, Range range);
+        void setRange(Range range);
+
+        /// @brief Attaches element buffer to vertex array. Indices are relative to the start of the vertex range
+        /// @param buffer Element buffer to attach
+        template <typename TIndex>
+        void bindElements(BasicElementBuffer<TIndex>& buffer);
+
+        /// @brief Attaches element buffer to vertex array with range. Indices are relative to the start of the vertex range
+        /// @param buffer Element buffer to attach
+        /// @param range Available range of indices
+        template <typename TIndex>
+        void bindElements(BasicElementBuffer<TIndex>& buffer, Range range);
+
+        /// @brief Check if the element buffer is attached
+        /// @return True if attached, otherwise false
+        bool hasElements() const;
 
         /// @brief Gets current binded vertex buffer
-        /// @return Current vertex buffer (nullptr possible)
+        /// @return Current vertex buffer (nullptr if no buffer is bound or it stores other vertex type)
         VertexBuffer* getCurrentVertexBuffer();
 
+        /// @brief Gets the attributes of the bound vertex type
+        /// @return Attribute descriptions (empty if no buffer is bound)
+        std::span<const VertexAttribute> getLayout() const;
+
+        /// @brief Gets the size of the bound vertex type
+        /// @return Distance between the vertices in bytes (0 if no buffer is bound)
+        size_t getStride() const;
+
         /// @brief Gets current vertex range
         /// @return Current range
         Range getRange() const;
 
+        /// @brief Gets current index range
+        /// @return Current range of the attached element buffer
+        Range getElementRange() const;
+
+        /// @brief Gets the OpenGL type of the attached indices
+        /// @return GL_UNSIGNED_SHORT, GL_UNSIGNED_INT or 0 if no element buffer attached
+        unsigned int getIndexType() const;
+
         /// @brief Gets vertex array native handle
         /// @return OpenGL vertex array handle
         unsigned int getNativeHandle() const override;
@@ -84,7 +200,96 @@ namespace bw::low_level
 
     private:
         unsigned int _handle;
-        VertexBuffer* _vertexBuffer;
+        std::vector<Stream> _streams;
         Range _range;
+
+        unsigned int _elementBuffer;
+        unsigned int _indexType;
+        Range _elementRange;
+
+        const Stream* _findStream(unsigned int binding) const;
+        void _bindStream(Stream stream);
+        void _bindElements(unsigned int handle, unsigned int indexType, Range range);
     };
+
+    ////////////////////////////////////////////////////////////
+
+    template <LayoutVertex TVertex>
+    VertexArray::VertexArray(BasicVertexBuffer<TVertex>& buffer, Range range) : VertexArray()
+    {
+        bindTo(buffer, range);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <LayoutVertex TVertex>
+    VertexArray::VertexArray(BasicVertexBuffer<TVertex>& buffer) : VertexArray(buffer, { 0, buffer.size() })
+    { }
+
+    ////////////////////////////////////////////////////////////
+
+    template <LayoutVertex TVertex>
+    void VertexArray::bindTo(BasicVertexBuffer<TVertex>& buffer)
+    {
+        bindTo(buffer, { 0, buffer.size() });
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <LayoutVertex TVertex>
+    void VertexArray::bindTo(BasicVertexBuffer<TVertex>& buffer, Range range)
+    {
+        bindStream(0, buffer);
+        _range = range;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <LayoutVertex TVertex>
+    void VertexArray::bindStream(unsigned int binding, BasicVertexBuffer<TVertex>& buffer, size_t offset, unsigned int divisor)
+    {
+        bindStream(binding, buffer, std::span<const VertexAttribute>(VertexLayout<TVertex>::Attributes), offset, divisor);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void VertexArray::bindStream(unsigned int binding, BasicVertexBuffer<T>& buffer, std::span<const VertexAttribute> attributes, 
+                                 size_t offset, unsigned int divisor)
+    {
+        _bindStream({ binding, &buffer, sizeof(T), offset * sizeof(T), divisor, { attributes.begin(), attributes.end() } });
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <LayoutVertex TInstance>
+    void VertexArray::bindInstances(unsigned int binding, BasicVertexBuffer<TInstance>& buffer, unsigned int divisor)
+    {
+        bindStream(binding, buffer, 0, divisor);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void VertexArray::bindStream(unsigned int binding, BasicVertexBuffer<T>& buffer, const VertexAttribute& attribute, 
+                                 size_t offset, unsigned int divisor)
+    {
+        bindStream(binding, buffer, std::span<const VertexAttribute>(&attribute, 1), offset, divisor);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TIndex>
+    void VertexArray::bindElements(BasicElementBuffer<TIndex>& buffer)
+    {
+        bindElements(buffer, { 0, buffer.size() });
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    template <typename TIndex>
+    void VertexArray::bindElements(BasicElementBuffer<TIndex>& buffer, Range range)
+    {
+        _bindElements(buffer.getNativeHandle(), buffer.getIndexType(), range);
+    }
 }
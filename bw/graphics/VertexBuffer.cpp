@@ -1,60 +1,43 @@
-#include <iostream>
 #include <stdexcept>
-#include <glad/glad.h>
+#include <algorithm>
 #include "VertexBuffer.hpp"
 
 namespace bw::low_level
 {
-    GLenum vb_bufferUsageToGLEnum(BufferUsage usage)
-    {
-        switch(usage)
-        {
-            case BufferUsage::Static:  return GL_STATIC_DRAW;
-            case BufferUsage::Dynamic: return GL_DYNAMIC_DRAW;
-            default:                   return GL_STREAM_DRAW;
-        }
-    }
-    
+    VertexBuffer::VertexBuffer(BufferUsage usage) : TypedBuffer(usage), _frameSize(0), _frameIndex(0) { }
+     
 	////////////////////////////////////////////////////////////
 
-    VertexBuffer::VertexBuffer(BufferUsage usage) : _handle(NullVertexBuffer)
-    {
-        glCreateBuffers(1, &_handle);
-        glNamedBufferData(_handle, 0, nullptr, vb_bufferUsageToGLEnum(usage));
-    }
-     
+    VertexBuffer::VertexBuffer(BufferUsage usage, std::span<const Vertex> initializer) : TypedBuffer(usage, initializer), _frameSize(0), _frameIndex(0) { }
+    
 	////////////////////////////////////////////////////////////
 
-    VertexBuffer::VertexBuffer(BufferUsage usage, std::span<Vertex> initializer) : _handle(NullVertexBuffer)
-    {
-        glCreateBuffers(1, &_handle);
-        glNamedBufferData(_handle, initializer.size() * sizeof(Vertex), 
-                          initializer.data(), vb_bufferUsageToGLEnum(usage));
-    }
+    VertexBuffer::VertexBuffer(BufferUsage usage, size_t reserveSize) : TypedBuffer(usage, reserveSize), _frameSize(0), _frameIndex(0) { }
     
 	////////////////////////////////////////////////////////////
 
-    VertexBuffer::VertexBuffer(BufferUsage usage, size_t reserveSize) : _handle(NullVertexBuffer)
+    VertexBuffer::VertexBuffer(BufferUsage usage, size_t frameSize, size_t frameCount) : VertexBuffer(usage, frameSize * frameCount)
     {
-        glCreateBuffers(1, &_handle);
-        glNamedBufferData(_handle, reserveSize * sizeof(Vertex), nullptr, vb_bufferUsageToGLEnum(usage));
+        if(usage == BufferUsage::Stream)
+        {
+            if(frameCount == 0)
+                throw std::invalid_argument("Stream ring needs at least one frame");
+
+            _createStream(frameSize, frameCount);
+        }
     }
     
 	////////////////////////////////////////////////////////////
 
-    VertexBuffer::VertexBuffer(const VertexBuffer& other) : _handle(NullVertexBuffer)
-    {
-        glCreateBuffers(1, &_handle);
-        this->reserve(other.size());
-        other.copyTo(*this);
-    }
+    VertexBuffer::VertexBuffer(const VertexBuffer& other) : TypedBuffer(other), _frameSize(0), _frameIndex(0) { }
     
 	////////////////////////////////////////////////////////////
 
-    VertexBuffer::VertexBuffer(VertexBuffer&& moved) noexcept : _handle(NullVertexBuffer)
+    VertexBuffer::VertexBuffer(VertexBuffer&& moved) noexcept : TypedBuffer(std::move(moved)), _frameSize(moved._frameSize), 
+                                                                _frameIndex(moved._frameIndex), _fences(std::move(moved._fences))
     {
-        _handle = moved._handle;
-        moved._handle = NullVertexBuffer;
+        moved._frameSize = 0;
+        moved._frameIndex = 0;
     }
     
 	////////////////////////////////////////////////////////////
@@ -68,10 +51,7 @@ namespace bw::low_level
     
     VertexBuffer& VertexBuffer::operator=(const VertexBuffer& other)
     {
-        if(this != &other)
-        {
-            other.copyTo(*this);
-        }
+        TypedBuffer::operator=(other);
         return *this;
     }
 
@@ -82,137 +62,147 @@ namespace bw::low_level
         if(this != &moved)
         {
             this->release();
+            TypedBuffer::operator=(std::move(moved));
 
-            _handle = moved._handle;
-            moved._handle = NullVertexBuffer;   
+            _frameSize = moved._frameSize;
+            _frameIndex = moved._frameIndex;
+            _fences = std::move(moved._fences);
+
+            moved._frameSize = 0;
+            moved._frameIndex = 0;
         }
         return *this;
     }
 
 	////////////////////////////////////////////////////////////
-    
-    bool VertexBuffer::operator==(const VertexBuffer& other) const
+        
+    void VertexBuffer::reserve(size_t size)
     {
-        return this == &other;
+        if (size <= this->size()) return;
+
+        // Immutable storage cannot grow, recreating it would leave the vertex arrays with a deleted handle
+        if (isStreaming())
+            throw std::logic_error("The stream ring cannot grow, create a new buffer with bigger frames");
+
+        TypedBuffer::reserve(size);
     }
-	
-    ////////////////////////////////////////////////////////////
+    
+	////////////////////////////////////////////////////////////
 
-    bool VertexBuffer::operator!=(const VertexBuffer& other) const
+    void VertexBuffer::update(size_t offset, std::span<const Vertex> vertices)
     {
-        return !(*this == other);
+        if (isStreaming())
+        {
+            std::span<Vertex> frame = getFrame();
+            if (offset + vertices.size() > frame.size())
+                throw std::out_of_range("Vertices do not fit into the stream frame");
+
+            std::copy(vertices.begin(), vertices.end(), frame.begin() + offset);
+            return;
+        }
+
+        TypedBuffer::update(offset, vertices);
     }
 
 	////////////////////////////////////////////////////////////
-        
-    void VertexBuffer::reserve(size_t size)
+    
+    void VertexBuffer::updateDiscard(std::span<const Vertex> vertices)
     {
-        size_t currentSize = this->size();
-        if (size <= currentSize) return;
+        // The stream ring never writes memory the GPU is reading
+        if (isStreaming())
+        {
+            update(0, vertices);
+            return;
+        }
 
-        std::vector<Vertex> oldData { data() };
-        glNamedBufferData(_handle, size * sizeof(Vertex), oldData.data(), vb_bufferUsageToGLEnum(getUsage()));
+        TypedBuffer::updateDiscard(vertices);
     }
-    
+
 	////////////////////////////////////////////////////////////
 
-    void VertexBuffer::update(size_t offset, std::span<Vertex> vertices)
+    void VertexBuffer::enableShadow(size_t mergeGap)
     {
-        glNamedBufferSubData(_handle, offset  * sizeof(Vertex), vertices.size()  * sizeof(Vertex), vertices.data());
+        if (isStreaming()) return;
+
+        TypedBuffer::enableShadow(mergeGap);
     }
 
 	////////////////////////////////////////////////////////////
-    
-    void VertexBuffer::update(std::span<Vertex> vertices)
+
+    std::span<Vertex> VertexBuffer::getFrame()
     {
-        update(0, vertices);
+        if (!isStreaming()) return {};
+
+        _waitFrame();
+        return { static_cast<Vertex*>(_storage.getPersistentMapping()) + getFrameOffset(), _frameSize };
     }
 
 	////////////////////////////////////////////////////////////
-    
-    void VertexBuffer::copyTo(IBufferStorage<Vertex>& buffer) const
+
+    void VertexBuffer::nextFrame()
     {
-        if (auto* vertexBuffer = dynamic_cast<VertexBuffer*>(&buffer)) 
-        {
-            size_t currentCapacity = this->capacity();
+        if (!isStreaming() || _fences.empty()) return;
 
-            if (vertexBuffer->capacity() < currentCapacity) {
-                vertexBuffer->reserve(currentCapacity / sizeof(Vertex));
-            }
-            glCopyNamedBufferSubData(_handle, vertexBuffer->_handle, 0, 0, currentCapacity);
-        }
-        else 
-        {
-            std::vector<Vertex> data = this->data();
-            buffer.update(data);
-        }
+        _fences[_frameIndex].signal();
+        _frameIndex = (_frameIndex + 1) % _fences.size();
     }
 
 	////////////////////////////////////////////////////////////
-    
-    std::vector<Vertex> VertexBuffer::data() const
+
+    size_t VertexBuffer::getFrameOffset() const
     {
-        return data(0, size());
+        return _frameIndex * _frameSize;
     }
 
 	////////////////////////////////////////////////////////////
 
-    std::vector<Vertex> VertexBuffer::data(size_t offset, size_t size) const
+    size_t VertexBuffer::getFrameSize() const
     {
-        std::vector<Vertex> container(size);
-        glGetNamedBufferSubData(_handle, offset  * sizeof(Vertex), size * sizeof(Vertex), container.data());
-        return container;
+        return _frameSize;
     }
-    
+
 	////////////////////////////////////////////////////////////
-    
-    size_t VertexBuffer::size() const
+
+    bool VertexBuffer::isStreaming() const
     {
-        return capacity() / sizeof(Vertex);
+        return _storage.isPersistent();
     }
     
 	////////////////////////////////////////////////////////////
-        
-    size_t VertexBuffer::capacity() const
+	
+    void VertexBuffer::release()
     {
-        GLint64 capacity;
-
-        glGetNamedBufferParameteri64v(_handle, GL_BUFFER_SIZE, &capacity);
-
-        return static_cast<size_t>(capacity);
+        _releaseStream();
+        TypedBuffer::release();
     }
 
 	////////////////////////////////////////////////////////////
 
-    BufferUsage VertexBuffer::getUsage() const
+    void VertexBuffer::_createStream(size_t frameSize, size_t frameCount)
     {
-        GLint usage;
-
-        glGetNamedBufferParameteriv(_handle, GL_BUFFER_USAGE, &usage);
-
-        switch(usage)
-        {
-            case GL_STATIC_DRAW:  return BufferUsage::Static;
-            case GL_DYNAMIC_DRAW: return BufferUsage::Dynamic;
-            default:              return BufferUsage::Stream;
-        }
+        _storage.storePersistent(frameSize * frameCount * sizeof(Vertex));
+        _frameSize = frameSize;
+        _frameIndex = 0;
+        _fences.clear();
+        _fences.resize(frameCount);
     }
-    
+
 	////////////////////////////////////////////////////////////
-        
-	unsigned int VertexBuffer::getNativeHandle() const
+
+    void VertexBuffer::_waitFrame()
     {
-        return _handle;
+        GpuFence& fence = _fences[_frameIndex];
+        
+        fence.wait();
+        fence.release();
     }
-    
+
 	////////////////////////////////////////////////////////////
-	
-    void VertexBuffer::release()
+
+    void VertexBuffer::_releaseStream()
     {
-        if(_handle != NullVertexBuffer)
-        {
-            glDeleteBuffers(1, &_handle);
-            _handle = NullVertexBuffer;
-        }
+        _fences.clear();
+        _frameSize = 0;
+        _frameIndex = 0;
     }
 }
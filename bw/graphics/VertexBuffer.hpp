@@ -1,22 +1,26 @@
 #pragma once
 
-#include "IBufferStorage.hpp"
-#include "IResource.hpp"
+#include "TypedBuffer.hpp"
+#include "GpuFence.hpp"
 #include "Vertex.hpp"
 
 namespace bw::low_level
 {
+    /// @brief Vertex buffer of a user-defined vertex type described by VertexLayout
+    template <typename TVertex>
+    using BasicVertexBuffer = TypedBuffer<TVertex, ArrayTarget>;
+
     /// 
     /// @class VertexBuffer
-    /// @brief Class that wraps the functionality of vertex buffers in the OpenGL API
+    /// @brief Class that wraps the functionality of vertex buffers in the OpenGL API.
+    /// Adds the persistently mapped stream ring to the common buffer functionality
     /// @implements IBufferStorage<Vertex>, IResource<unsigned int>
     ///
-    class VertexBuffer : public virtual IBufferStorage<Vertex>, 
-                         public virtual IResource<unsigned int>
+    class VertexBuffer : public TypedBuffer<Vertex, ArrayTarget>
     {
     public:
         /// @brief Constant for a non-existent vertex buffer
-        static const unsigned int NullVertexBuffer = 0;
+        static const unsigned int NullVertexBuffer = NullBuffer;
 
         /// @brief Creates and initializes an empty buffer with no memory
         /// @param usage Buffer usage type
@@ -25,13 +29,21 @@ namespace bw::low_level
         /// @brief Creates and initializes a buffer, and then fills it with the data
         /// @param usage Buffer usage type
         /// @param initializer Initialization data
-        VertexBuffer(BufferUsage usage, std::span<Vertex> initializer);
+        VertexBuffer(BufferUsage usage, std::span<const Vertex> initializer);
         
         /// @brief Creates and initializes a buffer, then reserves memory for future data
         /// @param usage Buffer usage type
         /// @param reserveSize Number of vertices for which memory will be allocated
         VertexBuffer(BufferUsage usage, size_t reserveSize);
 
+        /// @brief Creates and initializes a persistently mapped ring buffer for streaming vertices every frame.
+        /// Only BufferUsage::Stream enables the ring, other usages just reserve frameSize * frameCount vertices
+        /// @param usage Buffer usage type
+        /// @param frameSize Number of vertices that can be written during one frame
+        /// @param frameCount Number of frames in the ring
+        /// @throw std::invalid_argument If the stream ring has no frames
+        VertexBuffer(BufferUsage usage, size_t frameSize, size_t frameCount);
+
         VertexBuffer(const VertexBuffer& other);
         VertexBuffer(VertexBuffer&& moved) noexcept;
 
@@ -40,55 +52,57 @@ namespace bw::low_level
         VertexBuffer& operator=(const VertexBuffer& other);
         VertexBuffer& operator=(VertexBuffer&& moved) noexcept;
 
-        bool operator==(const VertexBuffer& other) const;
-        bool operator!=(const VertexBuffer& other) const;
+        using TypedBuffer::update;
 
         /// @brief Reserve memory for the vertex buffer without initializing it and deleting old data
         /// @param size Number of elements to reserve capacity for
+        /// @throw std::logic_error If the buffer is a stream ring, its immutable storage cannot grow without changing the handle
         void reserve(size_t size) override;
-        
-        /// @brief Update vertex buffer contents with new data
-        /// @param data Span containing the new data to update the vertex buffer with
-        void update(std::span<Vertex> vertices) override;
 
-        /// @brief Update vertex buffer contents with new data
+        /// @brief Update vertex buffer contents with new data.
+        /// For the stream ring the offset is relative to the current frame and the data is written directly to mapped memory
         /// @param offset Offset from the beginning of the previous data
         /// @param data Span containing the new data to update the vertex buffer with
-        void update(size_t offset, std::span<Vertex> vertices);        
+        void update(size_t offset, std::span<const Vertex> vertices) override;        
 
-        /// @brief Copy contents of this vertex buffer to another buffer
-        /// @param buffer Destination vertex buffer to copy data to
-        void copyTo(IBufferStorage<Vertex>& buffer) const override;
+        /// @brief Replace the whole vertex buffer contents, discarding the previous data.
+        /// The stream ring never writes memory the GPU is reading, so it is just updated
+        /// @param vertices Span containing the new data (the buffer grows if it does not fit)
+        void updateDiscard(std::span<const Vertex> vertices) override;
 
-        /// @brief Get a copy of the vertex buffer data
-        /// @return Vector containing a copy of all vertex buffer data
-        std::vector<Vertex> data() const override;        
+        /// @brief Enables the CPU-side shadow copy of the vertex buffer data.
+        /// Has no effect for the stream ring, which is written directly
+        /// @param mergeGap Maximum gap in elements between two dirty ranges uploaded as one region
+        void enableShadow(size_t mergeGap = BufferShadow<Vertex>::DefaultMergeGap) override;
 
-        /// @brief Get a copy of the vertex buffer data
-        /// @return Vector containing a copy of the data of the specified range in the vertex buffer
-        /// @param offset Offset from the beginning of the data
-        /// @param size Count of the vertices
-        std::vector<Vertex> data(size_t offset, size_t size) const;
-        
-        /// @brief Get the current max number of vertices vertex buffer can store
-        /// @return Size of the vertex buffer in number of elements
-        size_t size() const override;
-        
-        /// @brief Get the total capacity of the vertex buffer
-        /// @return Maximum memory the buffer can hold without reallocation
-        size_t capacity() const override;
+        /// @brief Gets the writable memory of the current stream frame, waits until the GPU stops reading it
+        /// @return Persistently mapped vertices of the current frame (empty if the buffer is not streaming)
+        std::span<Vertex> getFrame();
+
+        /// @brief Fences the current stream frame after the submitted draw calls and switches to the next frame
+        void nextFrame();
+
+        /// @brief Gets the offset of the current stream frame
+        /// @return Index of the first vertex of the current frame
+        size_t getFrameOffset() const;
+
+        /// @brief Gets the number of vertices in one stream frame
+        /// @return Frame size in number of vertices (0 if the buffer is not streaming)
+        size_t getFrameSize() const;
+
+        /// @brief Check if the buffer is a persistently mapped stream ring
+        /// @return True if streaming, otherwise false
+        bool isStreaming() const override;
 
-        /// @brief Get the current usage type of the vertex buffer
-        /// @return Vertex buffer usage type
-        BufferUsage getUsage() const;
-        
-		/// @brief Gets vertex buffer native handle
-		/// @return OpenGL vertex buffer handle
-		unsigned int getNativeHandle() const override;
-		
         /// @brief Releases vertex buffer memory
         void release() override;
     private:
-        unsigned int _handle;
+        size_t _frameSize;
+        size_t _frameIndex;
+        std::vector<GpuFence> _fences;
+
+        void _createStream(size_t frameSize, size_t frameCount);
+        void _waitFrame();
+        void _releaseStream();
     };
 }
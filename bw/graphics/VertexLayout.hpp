@@ -0,0 +1,204 @@
+#pragma once
+
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "math/Vec2.hpp"
+#include "math/Vec3.hpp"
+#include "math/Vec4.hpp"
+
+namespace bw::low_level
+{
+    ///
+    /// @struct ComponentTraits
+    /// @brief Traits of the scalar types that OpenGL can read vertex attribute components as
+    /// @tparam T Component type
+    ///
+    template <typename T>
+    struct ComponentTraits;
+
+    template <>
+    struct ComponentTraits<std::int8_t>
+    {
+        /// @brief Value of GL_BYTE
+        static constexpr unsigned int GLType = 0x1400;
+    };
+
+    template <>
+    struct ComponentTraits<std::uint8_t>
+    {
+        /// @brief Value of GL_UNSIGNED_BYTE
+        static constexpr unsigned int GLType = 0x1401;
+    };
+
+    template <>
+    struct ComponentTraits<std::int16_t>
+    {
+        /// @brief Value of GL_SHORT
+        static constexpr unsigned int GLType = 0x1402;
+    };
+
+    template <>
+    struct ComponentTraits<std::uint16_t>
+    {
+        /// @brief Value of GL_UNSIGNED_SHORT
+        static constexpr unsigned int GLType = 0x1403;
+    };
+
+    template <>
+    struct ComponentTraits<std::int32_t>
+    {
+        /// @brief Value of GL_INT
+        static constexpr unsigned int GLType = 0x1404;
+    };
+
+    template <>
+    struct ComponentTraits<std::uint32_t>
+    {
+        /// @brief Value of GL_UNSIGNED_INT
+        static constexpr unsigned int GLType = 0x1405;
+    };
+
+    template <>
+    struct ComponentTraits<float>
+    {
+        /// @brief Value of GL_FLOAT
+        static constexpr unsigned int GLType = 0x1406;
+    };
+
+    ///
+    /// @struct AttributeTraits
+    /// @brief Traits of the types that can be used as vertex attributes:
+    /// scalars, vectors and arrays of the types that have ComponentTraits.
+    /// Specialize it to describe other attribute types
+    /// @tparam T Attribute type
+    ///
+    template <typename T, typename = void>
+    struct AttributeTraits
+    {
+        /// @brief OpenGL type of the components
+        static constexpr unsigned int GLType = ComponentTraits<T>::GLType;
+        /// @brief Number of components (1 to 4)
+        static constexpr unsigned int Components = 1;
+        /// @brief True if the integer components are read by the shader as normalized floats by default
+        static constexpr bool Normalized = false;
+        /// @brief True if the components are read by the shader as integers unless normalized
+        static constexpr bool Integer = std::is_integral_v<T>;
+    };
+
+    ///
+    /// @struct VectorAttributeTraits
+    /// @brief Attribute traits of the vectors of N components of the type T
+    ///
+    template <typename T, unsigned int N>
+    struct VectorAttributeTraits
+    {
+        static constexpr unsigned int GLType = ComponentTraits<T>::GLType;
+        static constexpr unsigned int Components = N;
+        static constexpr bool Normalized = false;
+        static constexpr bool Integer = std::is_integral_v<T>;
+    };
+
+    template <typename T>
+    struct AttributeTraits<Vec2<T>> : VectorAttributeTraits<T, 2> { };
+
+    template <typename T>
+    struct AttributeTraits<Vec3<T>> : VectorAttributeTraits<T, 3> { };
+
+    template <typename T>
+    struct AttributeTraits<Vec4<T>> : VectorAttributeTraits<T, 4> { };
+
+    template <typename T, size_t N>
+    struct AttributeTraits<T[N], std::enable_if_t<(N >= 1 && N <= 4)>> : VectorAttributeTraits<T, N> { };
+
+    template <typename T, size_t N>
+    struct AttributeTraits<std::array<T, N>, std::enable_if_t<(N >= 1 && N <= 4)>> : VectorAttributeTraits<T, N> { };
+
+    ///
+    /// @struct VertexAttribute
+    /// @brief Description of a single vertex attribute inside the vertex structure
+    ///
+    struct VertexAttribute
+    {
+        /// @brief Shader location of the attribute
+        unsigned int location;
+        /// @brief Number of components (1 to 4)
+        unsigned int components;
+        /// @brief OpenGL type of the components
+        unsigned int type;
+        /// @brief True if the integer components are normalized to [0, 1] or [-1, 1]
+        bool normalized;
+        /// @brief True if the components are read by the shader as integers
+        bool integer;
+        /// @brief Offset of the attribute from the beginning of the vertex in bytes
+        size_t offset;
+        /// @brief Size of the attribute in bytes
+        size_t size;
+    };
+
+    ///
+    /// @brief Describes the attribute of the type T at compile time
+    /// @tparam T Attribute type (must have AttributeTraits)
+    /// @param location Shader location of the attribute
+    /// @param offset Offset of the attribute in the vertex (usually offsetof)
+    /// @param normalized True if the integer components are normalized
+    /// @return Attribute description
+    ///
+    template <typename T>
+    constexpr VertexAttribute makeAttribute(unsigned int location, size_t offset, bool normalized = AttributeTraits<T>::Normalized)
+    {
+        using Traits = AttributeTraits<T>;
+        return { location, Traits::Components, Traits::GLType, normalized, Traits::Integer && !normalized, offset, sizeof(T) };
+    }
+
+    ///
+    /// @struct VertexLayout
+    /// @brief Compile-time description of the vertex structure attributes used by the vertex arrays.
+    /// Specialize it for every vertex type with a static constexpr array of VertexAttribute named Attributes:
+    /// @code
+    /// template <>
+    /// struct VertexLayout<SpriteVertex>
+    /// {
+    ///     static constexpr std::array Attributes = {
+    ///         makeAttribute<Vec2f>(0, offsetof(SpriteVertex, position)),
+    ///         makeAttribute<Vec2f>(2, offsetof(SpriteVertex, texture))
+    ///     };
+    /// };
+    /// @endcode
+    /// @tparam TVertex Vertex type
+    ///
+    template <typename TVertex>
+    struct VertexLayout;
+
+    ///
+    /// @brief Checks at compile time that the attributes lie inside the vertex and have unique locations
+    /// @param attributes Attributes of the vertex
+    /// @param stride Size of the vertex in bytes
+    /// @return True if the layout is valid, otherwise false
+    ///
+    constexpr bool isValidLayout(std::span<const VertexAttribute> attributes, size_t stride)
+    {
+        for (size_t i = 0; i < attributes.size(); i++)
+        {
+            if (attributes[i].offset + attributes[i].size > stride) return false;
+            if (attributes[i].components < 1 || attributes[i].components > 4) return false;
+
+            for (size_t j = i + 1; j < attributes.size(); j++)
+            {
+                if (attributes[i].location == attributes[j].location) return false;
+            }
+        }
+        return true;
+    }
+
+    ///
+    /// @concept LayoutVertex
+    /// @brief Vertex type that has a valid VertexLayout and can be copied to the GPU as raw bytes
+    ///
+    template <typename TVertex>
+    concept LayoutVertex = std::is_trivially_copyable_v<TVertex> &&
+        requires { std::span<const VertexAttribute>(VertexLayout<TVertex>::Attributes); } &&
+        isValidLayout(VertexLayout<TVertex>::Attributes, sizeof(TVertex));
+}
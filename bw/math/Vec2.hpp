@@ -32,8 +32,8 @@ namespace bw
         Vec2(T x, T y) : x(x), y(y) { }
         Vec2() : Vec2(T{}, T{}) { }
         
-        Vec2(const Vec2& v) : x(v.x), y(v.y) { }
-        Vec2(Vec2&& moved) noexcept;
+        Vec2(const Vec2& v) = default;
+        Vec2(Vec2&& moved) noexcept = default;
 
         template <typename U>
         Vec2(const Vec2<U>& other) : x(static_cast<T>(other.x)), y(static_cast<T>(other.y)) {}
@@ -41,8 +41,8 @@ namespace bw
         template <typename U>
         Vec2(Vec2<U>&& moved);
 
-        Vec2& operator=(const Vec2& other);
-        Vec2& operator=(Vec2&& moved) noexcept;
+        Vec2& operator=(const Vec2& other) = default;
+        Vec2& operator=(Vec2&& moved) noexcept = default;
 
         constexpr bool operator==(const Vec2& other) const;
         constexpr bool operator!=(const Vec2& other) const;
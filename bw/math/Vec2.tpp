@@ -6,43 +6,12 @@
 
 namespace bw
 {
-    template <typename T>
-    Vec2<T>::Vec2(Vec2<T>&& moved) noexcept : x(std::move(moved.x)), y(std::move(moved.y)) { }
-
-    ////////////////////////////////////////////////////////////
-
     template <typename T>
     template <typename U>
     Vec2<T>::Vec2(Vec2<U>&& moved) : x(static_cast<T>(std::move(moved.x))), y(static_cast<T>(std::move(moved.y))) { }
 
     ////////////////////////////////////////////////////////////
 
-    template <typename T>
-    Vec2<T>& Vec2<T>::operator=(const Vec2<T>& other)
-    {
-        if (this != &other)
-        {
-            x = other.x;
-            y = other.y;
-        }
-        return *this;
-    }
-
-    ////////////////////////////////////////////////////////////
-
-    template <typename T>
-    Vec2<T>& Vec2<T>::operator=(Vec2<T>&& moved) noexcept
-    {        
-        if (this != &moved)
-        {
-            x = std::move(moved.x);
-            y = std::move(moved.y);
-        }
-        return *this;
-    }
-    
-    ////////////////////////////////////////////////////////////
-
     template <typename T>
     constexpr bool Vec2<T>::operator==(const Vec2<T>& other) const
     {
@@ -38,8 +38,8 @@ namespace bw
         Vec3(T x, T y, T z) : x(x), y(y), z(z) { }
         Vec3() : Vec3(T{}, T{}, T{}) { }
         
-        Vec3(const Vec3& v) : x(v.x), y(v.y), z(v.z) { }
-        Vec3(Vec3&& moved) noexcept;
+        Vec3(const Vec3& v) = default;
+        Vec3(Vec3&& moved) noexcept = default;
 
         template <typename U>
         Vec3(const Vec3<U>& other) : x(static_cast<T>(other.x)), y(static_cast<T>(other.y)), z(static_cast<T>(other.z)) {}
@@ -47,8 +47,8 @@ namespace bw
         template <typename U>
         Vec3(Vec3<U>&& moved);
 
-        Vec3& operator=(const Vec3& other);
-        Vec3& operator=(Vec3&& moved);
+        Vec3& operator=(const Vec3& other) = default;
+        Vec3& operator=(Vec3&& moved) noexcept = default;
 
         constexpr bool operator==(const Vec3& other) const;
         constexpr bool operator!=(const Vec3& other) const;
@@ -6,45 +6,12 @@
  
 namespace bw
 {
-    template <typename T>
-    Vec3<T>::Vec3(Vec3<T>&& moved) noexcept : x(std::move(moved.x)), y(std::move(moved.y)), z(std::move(moved.z)) { }
-
-    ////////////////////////////////////////////////////////////
-
     template <typename T>
     template <typename U>
     Vec3<T>::Vec3(Vec3<U>&& moved) : x(static_cast<T>(std::move(moved.x))), y(static_cast<T>(std::move(moved.y))), z(static_cast<T>(std::move(moved.z))) { }
 
     ////////////////////////////////////////////////////////////
 
-    template <typename T>
-    Vec3<T>& Vec3<T>::operator=(const Vec3<T>& other)
-    {
-        if (this != &other)
-        {
-            x = other.x;
-            y = other.y;
-            z = other.z;
-        }
-        return *this;
-    }
-
-    ////////////////////////////////////////////////////////////
-
-    template <typename T>
-    Vec3<T>& Vec3<T>::operator=(Vec3<T>&& moved)
-    {        
-        if (this != &moved)
-        {
-            x = std::move(moved.x);
-            y = std::move(moved.y);
-            z = std::move(moved.z);
-        }
-        return *this;
-    }
-    
-    ////////////////////////////////////////////////////////////
-
     template <typename T>
     constexpr bool Vec3<T>::operator==(const Vec3<T>& other) const
     {
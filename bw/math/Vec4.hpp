@@ -45,8 +45,8 @@ namespace bw
         Vec4(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) { }
         Vec4() : Vec4(T{}, T{}, T{}, T{}) { }
         
-        Vec4(const Vec4& v) : x(v.x), y(v.y), z(v.z), w(v.w) { }
-        Vec4(Vec4&& v) noexcept;
+        Vec4(const Vec4& v) = default;
+        Vec4(Vec4&& v) noexcept = default;
 
         template <typename U>
         Vec4(const Vec4<U>& other) : x(static_cast<T>(other.x)), y(static_cast<T>(other.y)), z(static_cast<T>(other.z)), w(static_cast<T>(other.w)) {}
@@ -54,8 +54,8 @@ namespace bw
         template <typename U>
         Vec4(Vec4<U>&& moved);
 
-        Vec4& operator=(const Vec4& v);
-        Vec4& operator=(Vec4&& v);
+        Vec4& operator=(const Vec4& v) = default;
+        Vec4& operator=(Vec4&& v) noexcept = default;
 
         constexpr bool operator==(const Vec4& v) const;
         constexpr bool operator!=(const Vec4& v) const;
@@ -6,47 +6,12 @@
 
 namespace bw
 {
-    template <typename T>
-    Vec4<T>::Vec4(Vec4<T>&& moved) noexcept : x(std::move(moved.x)), y(std::move(moved.y)), z(std::move(moved.z)), w(std::move(moved.w)) { }
-
-    ////////////////////////////////////////////////////////////
-
     template <typename T>
     template <typename U>
     Vec4<T>::Vec4(Vec4<U>&& moved) : x(static_cast<T>(std::move(moved.x))), y(static_cast<T>(std::move(moved.y))), z(static_cast<T>(std::move(moved.z))), w(static_cast<U>(std::move(moved.w))) {}
 
     ////////////////////////////////////////////////////////////
 
-    template <typename T>
-    Vec4<T>& Vec4<T>::operator=(const Vec4<T>& other)
-    {
-        if (this != &other)
-        {
-            x = other.x;
-            y = other.y;
-            z = other.z;
-            w = other.w;
-        }
-        return *this;
-    }
-
-    ////////////////////////////////////////////////////////////
-
-    template <typename T>
-    Vec4<T>& Vec4<T>::operator=(Vec4<T>&& moved)
-    {        
-        if (this != &moved)
-        {
-            x = std::move(moved.x);
-            y = std::move(moved.y);
-            z = std::move(moved.z);
-            w = std::move(moved.w);
-        }
-        return *this;
-    }
-    
-    ////////////////////////////////////////////////////////////
-
     template <typename T>
     constexpr bool Vec4<T>::operator==(const Vec4<T>& other) const
     {
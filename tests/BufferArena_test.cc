@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/BufferArena.hpp>
+#include <graphics/GpuVector.hpp>
+#include <graphics/VertexBuffer.hpp>
+#include <graphics/ElementBuffer.hpp>
+#include <vector>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST_F(OpenGLTestEnvironment, BufferArena_AllocateWithData)
+{
+    VertexBuffer buffer(BufferUsage::Static, 8);
+    BufferArena<Vertex> arena(buffer);
+
+    std::vector<Vertex> first = { Vertex(Vec3f(1, 0, 0), Vec4f(1, 1, 1, 1)), Vertex(Vec3f(2, 0, 0), Vec4f(1, 1, 1, 1)) };
+    std::vector<Vertex> second = { Vertex(Vec3f(3, 0, 0), Vec4f(1, 1, 1, 1)) };
+
+    auto firstSlice = arena.allocate(first);
+    auto secondSlice = arena.allocate(second);
+
+    EXPECT_EQ(firstSlice, BufferSlice(0, 2));
+    EXPECT_EQ(secondSlice, BufferSlice(2, 1));
+    EXPECT_EQ(arena.used(), 3u);
+
+    auto data = buffer.data(secondSlice.offset, secondSlice.count);
+    EXPECT_EQ(data[0].position.x, 3);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, BufferArena_GrowKeepsSlices)
+{
+    ElementBuffer buffer(BufferUsage::Static, 4);
+    BufferArena<unsigned int> arena(buffer);
+    auto handle = buffer.getNativeHandle();
+
+    std::vector<unsigned int> first = { 1, 2, 3, 4 };
+    std::vector<unsigned int> second = { 5, 6 };
+
+    auto firstSlice = arena.allocate(first);
+    auto secondSlice = arena.allocate(second);
+
+    EXPECT_GE(arena.capacity(), 6u);
+    EXPECT_EQ(buffer.size(), arena.capacity());
+    EXPECT_EQ(buffer.getNativeHandle(), handle);
+
+    EXPECT_EQ(buffer.data(firstSlice.offset, firstSlice.count), first);
+    EXPECT_EQ(buffer.data(secondSlice.offset, secondSlice.count), second);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, BufferArena_FreeAndUpdate)
+{
+    ElementBuffer buffer(BufferUsage::Dynamic, 16);
+    BufferArena<unsigned int> arena(buffer);
+
+    auto slice = arena.allocate(4);
+    std::vector<unsigned int> indices = { 7, 8, 9, 10, 11 };
+
+    EXPECT_THROW(arena.update(slice, indices), std::out_of_range);
+
+    arena.free(slice);
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_EQ(arena.allocate(4), slice);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, BufferArena_RejectsStreamRing)
+{
+    VertexBuffer buffer(BufferUsage::Stream, 16, 3);
+
+    EXPECT_THROW(BufferArena<Vertex> arena(buffer), std::invalid_argument);
+    EXPECT_THROW(GpuVector<Vertex> vector(buffer), std::invalid_argument);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/BufferPool.hpp>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST_F(OpenGLTestEnvironment, BufferPool_SizeClass)
+{
+    EXPECT_EQ(VertexBufferPool::getSizeClass(0), 0u);
+    EXPECT_EQ(VertexBufferPool::getSizeClass(1), 0u);
+    EXPECT_EQ(VertexBufferPool::getSizeClass(5), 3u);
+    EXPECT_EQ(VertexBufferPool::getSizeClass(8), 3u);
+    EXPECT_EQ(VertexBufferPool::getSizeClass(9), 4u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, BufferPool_AcquireRoundsUp)
+{
+    VertexBufferPool pool;
+    
+    VertexBuffer buffer = pool.acquire(BufferUsage::Dynamic, 100);
+    
+    EXPECT_EQ(buffer.size(), 128u);
+    EXPECT_EQ(buffer.getUsage(), BufferUsage::Dynamic);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, BufferPool_RecycleReusesHandle)
+{
+    ElementBufferPool pool;
+    
+    ElementBuffer buffer = pool.acquire(BufferUsage::Dynamic, 60);
+    auto handle = buffer.getNativeHandle();
+    pool.recycle(std::move(buffer));
+    
+    EXPECT_EQ(pool.getFreeCount(), 1u);
+    
+    // Another usage or class does not take the free buffer
+    ElementBuffer other = pool.acquire(BufferUsage::Static, 60);
+    EXPECT_NE(other.getNativeHandle(), handle);
+    
+    ElementBuffer reused = pool.acquire(BufferUsage::Dynamic, 33);
+    EXPECT_EQ(reused.getNativeHandle(), handle);
+    EXPECT_EQ(pool.getFreeCount(), 0u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, BufferPool_TrimIdleBuffers)
+{
+    VertexBufferPool pool(2);
+    
+    pool.recycle(pool.acquire(BufferUsage::Stream, 16));
+    
+    pool.nextFrame();
+    pool.nextFrame();
+    EXPECT_EQ(pool.getFreeCount(), 1u);
+    
+    pool.nextFrame();
+    EXPECT_EQ(pool.getFreeCount(), 0u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, BufferPool_StreamingBuffersAreNotPooled)
+{
+    VertexBufferPool pool;
+
+    pool.recycle(VertexBuffer(BufferUsage::Stream, 16, 3));
+    EXPECT_EQ(pool.getFreeCount(), 0u);
+
+    VertexBuffer buffer = pool.acquire(BufferUsage::Stream, 16);
+    EXPECT_FALSE(buffer.isStreaming());
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <graphics/BufferShadow.hpp>
+#include <vector>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST(BufferShadow, WriteMarksDirty)
+{
+    BufferShadow<int> shadow(std::vector<int>(16, 0));
+    EXPECT_FALSE(shadow.isDirty());
+
+    std::vector<int> values = { 1, 2 };
+    shadow.write(4, values);
+
+    EXPECT_TRUE(shadow.isDirty());
+    EXPECT_EQ(shadow.data()[5], 2);
+    EXPECT_EQ(shadow.getStats().bytesTouched, 2 * sizeof(int));
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(BufferShadow, OverlappingRangesAreMerged)
+{
+    BufferShadow<int> shadow(std::vector<int>(16, 0), 0);
+
+    std::vector<int> values = { 1, 2, 3 };
+    shadow.write(2, values);
+    shadow.write(4, values);
+    shadow.write(7, values);
+
+    auto regions = shadow.takeDirtyRegions();
+
+    ASSERT_EQ(regions.size(), 1u);
+    EXPECT_EQ(regions[0], BufferSlice(2, 8));
+    EXPECT_FALSE(shadow.isDirty());
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(BufferShadow, NearbyRangesAreCoalesced)
+{
+    BufferShadow<int> shadow(std::vector<int>(256, 0), 4);
+
+    std::vector<int> value = { 1 };
+    shadow.write(0, value);
+    shadow.write(4, value);
+    shadow.write(100, value);
+
+    auto regions = shadow.takeDirtyRegions();
+
+    ASSERT_EQ(regions.size(), 2u);
+    EXPECT_EQ(regions[0], BufferSlice(0, 5));
+    EXPECT_EQ(regions[1], BufferSlice(100, 1));
+
+    auto& stats = shadow.getStats();
+    EXPECT_EQ(stats.bytesTouched, 3 * sizeof(int));
+    EXPECT_EQ(stats.bytesUploaded, 6 * sizeof(int));
+    EXPECT_EQ(stats.uploadCount, 2u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(BufferShadow, WriteOutOfRangeThrows)
+{
+    BufferShadow<int> shadow(std::vector<int>(4, 0));
+
+    std::vector<int> values = { 1, 2 };
+    EXPECT_THROW(shadow.write(3, values), std::out_of_range);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(BufferShadow, ResizeDropsRemovedRanges)
+{
+    BufferShadow<int> shadow(std::vector<int>(16, 0), 0);
+
+    std::vector<int> values = { 1, 2, 3, 4 };
+    shadow.write(6, values);
+    shadow.write(12, values);
+    shadow.resize(8);
+
+    auto regions = shadow.takeDirtyRegions();
+
+    ASSERT_EQ(regions.size(), 1u);
+    EXPECT_EQ(regions[0], BufferSlice(6, 2));
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <glad/glad.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/ComputeProgram.hpp>
+#include <graphics/VertexBuffer.hpp>
+#include <vector>
+
+using namespace bw;
+using namespace bw::low_level;
+
+static const char* DoubleSource = R"(
+#version 460 core
+layout(local_size_x = 64) in;
+
+layout(std430, binding = 0) buffer Values
+{
+    float values[];
+};
+
+void main()
+{
+    uint i = gl_GlobalInvocationID.x;
+    if (i < values.length())
+        values[i] *= 2.0;
+}
+)";
+
+TEST(ComputeProgram, GroupCount)
+{
+    EXPECT_EQ(ComputeProgram::groupCount(0, 64), 0u);
+    EXPECT_EQ(ComputeProgram::groupCount(1, 64), 1u);
+    EXPECT_EQ(ComputeProgram::groupCount(64, 64), 1u);
+    EXPECT_EQ(ComputeProgram::groupCount(65, 64), 2u);
+    EXPECT_THROW(ComputeProgram::groupCount(10, 0), std::invalid_argument);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ComputeProgram_Dispatch)
+{
+    Shader shader(Shader::Compute, DoubleSource);
+    ASSERT_TRUE(shader.compile());
+    EXPECT_EQ(shader.getType(), Shader::Compute);
+
+    ComputeProgram program(shader);
+    EXPECT_EQ(program.getWorkGroupSize().x, 64);
+
+    std::vector<float> values(100);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = static_cast<float>(i);
+
+    StorageBuffer<float> buffer(BufferUsage::Dynamic, values);
+    buffer.bindBase(0);
+
+    program.dispatch(ComputeProgram::groupCount(values.size(), 64));
+    memoryBarrier(BufferUpdateBarrier);
+
+    auto result = buffer.data();
+    ASSERT_EQ(result.size(), values.size());
+    for (size_t i = 0; i < values.size(); i++)
+        EXPECT_FLOAT_EQ(result[i], values[i] * 2.0f);
+
+    DispatchIndirectBuffer commands(BufferUsage::Static, std::vector<DispatchIndirectCommand>{ { 2, 1, 1 } });
+    program.dispatchIndirect(commands);
+    memoryBarrier(BufferUpdateBarrier);
+
+    EXPECT_FLOAT_EQ(buffer.data()[99], 99.0f * 4.0f);
+    EXPECT_THROW(program.dispatchIndirect(commands, 1), std::out_of_range);
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ComputeProgram_RejectsOtherShaders)
+{
+    Shader shader(Shader::Vertex, "#version 460 core\nvoid main() { gl_Position = vec4(0.0); }\n");
+    ASSERT_TRUE(shader.compile());
+
+    EXPECT_THROW(ComputeProgram program(shader), std::invalid_argument);
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <graphics/CopyRegion.hpp>
+#include <vector>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST(CopyRegion, CoalesceContinuousRegions)
+{
+    std::vector<CopyRegion> regions = { { 4, 14, 2 }, { 0, 10, 4 }, { 8, 20, 1 } };
+
+    size_t count = coalesceCopyRegions(regions, 16, 32, false);
+
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(regions[0], CopyRegion(0, 10, 6));
+    EXPECT_EQ(regions[1], CopyRegion(8, 20, 1));
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(CopyRegion, EmptyRegionsAreRemoved)
+{
+    std::vector<CopyRegion> regions = { { 0, 0, 0 }, { 1, 1, 0 } };
+
+    EXPECT_EQ(coalesceCopyRegions(regions, 4, 4, false), 0u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(CopyRegion, OutOfRangeThrows)
+{
+    std::vector<CopyRegion> source = { { 3, 0, 2 } };
+    std::vector<CopyRegion> destination = { { 0, 7, 2 } };
+
+    EXPECT_THROW(coalesceCopyRegions(source, 4, 8, false), std::out_of_range);
+    EXPECT_THROW(coalesceCopyRegions(destination, 4, 8, false), std::out_of_range);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(CopyRegion, OverlapThrows)
+{
+    std::vector<CopyRegion> destinations = { { 0, 0, 4 }, { 8, 2, 4 } };
+    std::vector<CopyRegion> sameBuffer = { { 0, 2, 4 } };
+
+    EXPECT_THROW(coalesceCopyRegions(destinations, 16, 16, false), std::invalid_argument);
+    EXPECT_THROW(coalesceCopyRegions(sameBuffer, 16, 16, true), std::invalid_argument);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(CopyRegion, SameBufferMergeKeepsRangesApart)
+{
+    // The second region reads what the first one writes, so the result would depend on the copy order
+    std::vector<CopyRegion> chained = { { 0, 2, 2 }, { 2, 4, 2 } };
+    EXPECT_THROW(coalesceCopyRegions(chained, 8, 8, true), std::invalid_argument);
+
+    // The first region reads what the second one writes
+    std::vector<CopyRegion> reversed = { { 6, 0, 2 }, { 0, 6, 2 } };
+    EXPECT_THROW(coalesceCopyRegions(reversed, 8, 8, true), std::invalid_argument);
+
+    // Separate ranges of one buffer are merged as usual
+    std::vector<CopyRegion> apart = { { 0, 8, 2 }, { 2, 10, 2 } };
+    EXPECT_EQ(coalesceCopyRegions(apart, 16, 16, true), 1u);
+    EXPECT_EQ(apart[0], CopyRegion(0, 8, 4));
+}
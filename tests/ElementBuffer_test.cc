@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
+#include <glad/glad.h>
 #include "OpenGLTestEnvironment.hpp"
 #include <graphics/ElementBuffer.hpp>
+#include <array>
+#include <ranges>
 
 using namespace bw;
 using namespace bw::low_level;
@@ -19,12 +22,12 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_DefaultConstructor)
 
 TEST_F(OpenGLTestEnvironment, ElementBuffer_ConstructorWithInitialData)
 {
-    std::vector<size_t> indices = {0, 1, 2, 0, 2, 3};
+    std::vector<unsigned int> indices = {0, 1, 2, 0, 2, 3};
     
     ElementBuffer buffer(BufferUsage::Static, indices);
     
     EXPECT_EQ(buffer.size(), 6u);
-    EXPECT_GE(buffer.capacity(), 6 * sizeof(size_t));
+    EXPECT_GE(buffer.capacity(), 6 * sizeof(unsigned int));
     EXPECT_EQ(buffer.getUsage(), BufferUsage::Static);
     
     auto retrievedData = buffer.data();
@@ -40,7 +43,7 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_ConstructorWithReserve)
     ElementBuffer buffer(BufferUsage::Dynamic, reserveSize);
     
     EXPECT_EQ(buffer.size(), 100u);
-    EXPECT_GE(buffer.capacity(), reserveSize * sizeof(size_t));
+    EXPECT_GE(buffer.capacity(), reserveSize * sizeof(unsigned int));
     EXPECT_EQ(buffer.getUsage(), BufferUsage::Dynamic);
 }
 
@@ -48,7 +51,7 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_ConstructorWithReserve)
 
 TEST_F(OpenGLTestEnvironment, ElementBuffer_CopyConstructor)
 {
-    std::vector<size_t> indices = {0, 1, 2, 0, 2, 3};
+    std::vector<unsigned int> indices = {0, 1, 2, 0, 2, 3};
     
     ElementBuffer original(BufferUsage::Static, indices);
     ElementBuffer copy(original);
@@ -67,7 +70,7 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_CopyConstructor)
 
 TEST_F(OpenGLTestEnvironment, ElementBuffer_MoveConstructor)
 {
-    std::vector<size_t> indices = {0, 1, 2};
+    std::vector<unsigned int> indices = {0, 1, 2};
     
     ElementBuffer original(BufferUsage::Static, indices);
     unsigned int originalHandle = original.getNativeHandle();
@@ -85,7 +88,7 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_UpdateData)
 {
     ElementBuffer buffer(BufferUsage::Dynamic, 3);
     
-    std::vector<size_t> indices = {0, 1, 2};
+    std::vector<unsigned int> indices = {0, 1, 2};
     
     buffer.update(indices);
     
@@ -100,11 +103,11 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_UpdateDataWithOffset)
 {
     ElementBuffer buffer(BufferUsage::Dynamic, 5);
     
-    std::vector<size_t> initialIndices = {0, 1, 2};
+    std::vector<unsigned int> initialIndices = {0, 1, 2};
     
     buffer.update(initialIndices);
     
-    std::vector<size_t> updateIndices = {42};
+    std::vector<unsigned int> updateIndices = {42};
     
     buffer.update(1, updateIndices);
     
@@ -125,7 +128,7 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_ReserveMemory)
     
     buffer.reserve(newCapacity);
     
-    EXPECT_GE(buffer.capacity(), newCapacity * sizeof(size_t));
+    EXPECT_GE(buffer.capacity(), newCapacity * sizeof(unsigned int));
     EXPECT_EQ(buffer.size(), newCapacity);
 }
 
@@ -133,7 +136,7 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_ReserveMemory)
 
 TEST_F(OpenGLTestEnvironment, ElementBuffer_CopyTo)
 {
-    std::vector<size_t> indices = {0, 1, 2, 3, 4};
+    std::vector<unsigned int> indices = {0, 1, 2, 3, 4};
     
     ElementBuffer source(BufferUsage::Static, indices);
     ElementBuffer destination(BufferUsage::Static);
@@ -152,7 +155,7 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_CopyTo)
 
 TEST_F(OpenGLTestEnvironment, ElementBuffer_DataRange)
 {
-    std::vector<size_t> indices = {10, 20, 30, 40, 50};
+    std::vector<unsigned int> indices = {10, 20, 30, 40, 50};
     
     ElementBuffer buffer(BufferUsage::Static, indices);
     
@@ -182,7 +185,7 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_EqualityOperators)
 
 TEST_F(OpenGLTestEnvironment, ElementBuffer_MoveAssignment)
 {
-    std::vector<size_t> indices = {0, 1, 2};
+    std::vector<unsigned int> indices = {0, 1, 2};
     
     ElementBuffer original(BufferUsage::Static, indices);
     unsigned int originalHandle = original.getNativeHandle();
@@ -199,7 +202,7 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_MoveAssignment)
 
 TEST_F(OpenGLTestEnvironment, ElementBuffer_CopyAssignment)
 {
-    std::vector<size_t> indices = {5, 10, 15, 20};
+    std::vector<unsigned int> indices = {5, 10, 15, 20};
     
     ElementBuffer original(BufferUsage::Static, indices);
     ElementBuffer copy(BufferUsage::Dynamic);
@@ -271,3 +274,176 @@ TEST_F(OpenGLTestEnvironment, ElementBuffer_UsageTypeConversion)
     ElementBuffer streamBuffer(BufferUsage::Stream);
     EXPECT_EQ(streamBuffer.getUsage(), BufferUsage::Stream);
 }
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_ReserveKeepsData)
+{
+    std::vector<unsigned int> indices = {7, 8, 9};
+    
+    ElementBuffer buffer(BufferUsage::Static, indices);
+    unsigned int handle = buffer.getNativeHandle();
+    
+    buffer.reserve(10);
+    
+    EXPECT_EQ(buffer.getNativeHandle(), handle);
+    EXPECT_EQ(buffer.size(), 10u);
+    EXPECT_EQ(buffer.data(0, 3), indices);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_IndexTypes)
+{
+    std::vector<unsigned short> shortIndices = {0, 1, 2};
+    std::vector<unsigned int> intIndices = {0, 1, 2};
+    
+    ElementBuffer16 buffer16(BufferUsage::Static, shortIndices);
+    ElementBuffer32 buffer32(BufferUsage::Static, intIndices);
+    
+    EXPECT_EQ(buffer16.getIndexType(), static_cast<unsigned int>(GL_UNSIGNED_SHORT));
+    EXPECT_EQ(buffer32.getIndexType(), static_cast<unsigned int>(GL_UNSIGNED_INT));
+    EXPECT_EQ(buffer16.capacity(), 3 * sizeof(unsigned short));
+    EXPECT_EQ(buffer32.capacity(), 3 * sizeof(unsigned int));
+    EXPECT_EQ(buffer16.data(), shortIndices);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_ReadAsync)
+{
+    std::vector<unsigned int> indices = {10, 20, 30, 40};
+    
+    ElementBuffer buffer(BufferUsage::Static, indices);
+    
+    auto readback = buffer.readAsync(0, 4);
+    
+    std::vector<unsigned int> retrievedData(4);
+    readback.readInto(retrievedData);
+    
+    EXPECT_TRUE(readback.isReady());
+    EXPECT_EQ(retrievedData, indices);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_UpdateDiscard)
+{
+    ElementBuffer buffer(BufferUsage::Dynamic, 4);
+    
+    std::vector<unsigned int> indices = { 3, 2, 1 };
+    buffer.updateDiscard(indices);
+    
+    EXPECT_EQ(buffer.size(), 4u);
+    EXPECT_EQ(buffer.data(0, 3), indices);
+    
+    std::vector<unsigned int> larger = { 1, 2, 3, 4, 5 };
+    buffer.updateDiscard(larger);
+    
+    EXPECT_EQ(buffer.data(), larger);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_ShadowFlush)
+{
+    std::vector<unsigned int> initial = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    ElementBuffer buffer(BufferUsage::Dynamic, initial);
+    buffer.enableShadow(1);
+    
+    std::vector<unsigned int> value = { 9 };
+    buffer.update(1, value);
+    buffer.update(3, value);
+    buffer.update(7, value);
+    
+    // Pending changes are visible through the shadow copy before the flush
+    EXPECT_EQ(buffer.data()[3], 9u);
+    
+    buffer.flush();
+    
+    // 1 and 3 are separated by one clean index and uploaded as one region
+    auto stats = buffer.getShadowStats();
+    EXPECT_EQ(stats.uploadCount, 2u);
+    EXPECT_EQ(stats.bytesUploaded, 4 * sizeof(unsigned int));
+    
+    buffer.disableShadow();
+    
+    std::vector<unsigned int> expected = { 0, 9, 2, 9, 4, 5, 6, 9 };
+    EXPECT_EQ(buffer.data(), expected);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_UpdateConstData)
+{
+    const std::vector<unsigned int> indices = { 4, 5, 6 };
+    ElementBuffer buffer(BufferUsage::Dynamic, indices);
+    
+    buffer.update(indices);
+    
+    EXPECT_EQ(buffer.data(), indices);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_ReadInto)
+{
+    std::vector<unsigned int> indices = { 1, 2, 3, 4, 5 };
+    ElementBuffer buffer(BufferUsage::Static, indices);
+    
+    std::array<unsigned int, 3> out = {};
+    buffer.readInto(out, 2);
+    
+    EXPECT_EQ(out[0], 3u);
+    EXPECT_EQ(out[2], 5u);
+    EXPECT_THROW(buffer.readInto(out, 3), std::out_of_range);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_UpdateRange)
+{
+    // The range is larger than the upload chunk, so it is uploaded in several parts
+    const unsigned int count = 3000;
+    ElementBuffer buffer(BufferUsage::Dynamic, count);
+    
+    buffer.updateRange(0, std::views::iota(0u, count));
+    
+    auto data = buffer.data();
+    EXPECT_EQ(data[0], 0u);
+    EXPECT_EQ(data[count - 1], count - 1);
+    
+    buffer.generate(10, 5, [](size_t index) { return static_cast<unsigned int>(index * 2); });
+    
+    EXPECT_EQ(buffer.data(10, 5), std::vector<unsigned int>({ 0, 2, 4, 6, 8 }));
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_CopyRanges)
+{
+    std::vector<unsigned int> indices = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    ElementBuffer source(BufferUsage::Static, indices);
+    ElementBuffer destination(BufferUsage::Static, 8);
+    destination.update(std::vector<unsigned int>(8, 0));
+    
+    std::vector<CopyRegion> regions = { { 2, 0, 2 }, { 6, 5, 2 } };
+    source.copyRanges(destination, regions);
+    
+    std::vector<unsigned int> expected = { 2, 3, 0, 0, 0, 6, 7, 0 };
+    EXPECT_EQ(destination.data(), expected);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, ElementBuffer_CopyRangesWithinBuffer)
+{
+    std::vector<unsigned int> indices = { 0, 1, 2, 3, 4, 5 };
+    ElementBuffer buffer(BufferUsage::Static, indices);
+    
+    std::vector<CopyRegion> regions = { { 0, 3, 3 } };
+    buffer.copyRanges(buffer, regions);
+    
+    std::vector<unsigned int> expected = { 0, 1, 2, 0, 1, 2 };
+    EXPECT_EQ(buffer.data(), expected);
+}
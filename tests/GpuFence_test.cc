@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <glad/glad.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/GpuFence.hpp>
+#include <chrono>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST_F(OpenGLTestEnvironment, GpuFence_EmptyIsSignaled)
+{
+    GpuFence fence;
+
+    EXPECT_EQ(fence.getNativeHandle(), nullptr);
+    EXPECT_TRUE(fence.isSignaled());
+    EXPECT_TRUE(fence.wait());
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, GpuFence_SignalAndWait)
+{
+    GpuFence fence;
+    fence.signal();
+
+    EXPECT_NE(fence.getNativeHandle(), nullptr);
+    EXPECT_TRUE(fence.wait());
+    EXPECT_TRUE(fence.isSignaled());
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, GpuFence_WaitWithTimeout)
+{
+    GpuFence fence;
+    fence.signal();
+
+    EXPECT_TRUE(fence.wait(std::chrono::seconds(1)));
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, GpuFence_NegativeTimeout)
+{
+    GpuFence fence;
+    fence.signal();
+    glFinish();
+
+    // A negative timeout only polls the fence
+    EXPECT_TRUE(fence.wait(std::chrono::nanoseconds(-1)));
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, GpuFence_MoveConstructor)
+{
+    GpuFence fence;
+    fence.signal();
+    auto handle = fence.getNativeHandle();
+
+    GpuFence moved(std::move(fence));
+
+    EXPECT_EQ(moved.getNativeHandle(), handle);
+    EXPECT_EQ(fence.getNativeHandle(), nullptr);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, GpuFence_Release)
+{
+    GpuFence fence;
+    fence.signal();
+    fence.release();
+
+    EXPECT_EQ(fence.getNativeHandle(), nullptr);
+    EXPECT_TRUE(fence.isSignaled());
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/GpuVector.hpp>
+#include <graphics/ElementBuffer.hpp>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST_F(OpenGLTestEnvironment, GpuVector_DefaultConstructor)
+{
+    ElementBuffer buffer(BufferUsage::Dynamic);
+    GpuVector<unsigned int> vector(buffer);
+    
+    EXPECT_TRUE(vector.empty());
+    EXPECT_EQ(vector.size(), 0u);
+    EXPECT_EQ(vector.capacity(), 0u);
+    EXPECT_EQ(&vector.getStorage(), &buffer);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, GpuVector_PushBack)
+{
+    ElementBuffer buffer(BufferUsage::Dynamic);
+    GpuVector<unsigned int> vector(buffer);
+    
+    vector.pushBack(4);
+    vector.pushBack(5);
+    
+    EXPECT_EQ(vector.size(), 2u);
+    EXPECT_GE(vector.capacity(), GpuVector<unsigned int>::MinCapacity);
+    EXPECT_EQ(buffer.data(0, 2), std::vector<unsigned int>({4, 5}));
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, GpuVector_AppendGrowsGeometrically)
+{
+    ElementBuffer buffer(BufferUsage::Dynamic);
+    GpuVector<unsigned int> vector(buffer, 2.0f);
+    
+    std::vector<unsigned int> indices(GpuVector<unsigned int>::MinCapacity, 1);
+    vector.append(indices);
+    EXPECT_EQ(vector.capacity(), GpuVector<unsigned int>::MinCapacity);
+    
+    vector.pushBack(2);
+    EXPECT_EQ(vector.size(), GpuVector<unsigned int>::MinCapacity + 1);
+    EXPECT_EQ(vector.capacity(), 2 * GpuVector<unsigned int>::MinCapacity);
+    EXPECT_EQ(buffer.data(GpuVector<unsigned int>::MinCapacity, 1)[0], 2u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, GpuVector_ResizeAndClear)
+{
+    ElementBuffer buffer(BufferUsage::Dynamic);
+    GpuVector<unsigned int> vector(buffer);
+    
+    vector.resize(100);
+    EXPECT_EQ(vector.size(), 100u);
+    EXPECT_GE(vector.capacity(), 100u);
+    
+    size_t capacity = vector.capacity();
+    vector.clear();
+    
+    EXPECT_TRUE(vector.empty());
+    EXPECT_EQ(vector.capacity(), capacity);
+}
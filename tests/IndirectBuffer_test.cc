@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <glad/glad.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/IndirectBuffer.hpp>
+#include <graphics/RenderCanvas.hpp>
+#include <graphics/VertexArray.hpp>
+#include <vector>
+
+using namespace bw;
+using namespace bw::low_level;
+
+static_assert(sizeof(DrawArraysIndirectCommand) == 16);
+static_assert(sizeof(DrawElementsIndirectCommand) == 20);
+
+TEST(IndirectBuffer, MakeDrawCommand)
+{
+    auto arrays = makeDrawCommand({ 12, 6 }, 3, 2);
+    EXPECT_EQ(arrays.count, 6u);
+    EXPECT_EQ(arrays.instanceCount, 3u);
+    EXPECT_EQ(arrays.first, 12u);
+    EXPECT_EQ(arrays.baseInstance, 2u);
+
+    auto elements = makeDrawCommand({ 100, 4 }, { 30, 6 });
+    EXPECT_EQ(elements.count, 6u);
+    EXPECT_EQ(elements.instanceCount, 1u);
+    EXPECT_EQ(elements.firstIndex, 30u);
+    EXPECT_EQ(elements.baseVertex, 100);
+    EXPECT_EQ(elements.baseInstance, 0u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, IndirectBuffer_StoreCommands)
+{
+    std::vector<DrawElementsIndirectCommand> commands = {
+        makeDrawCommand({ 0, 4 }, { 0, 6 }),
+        makeDrawCommand({ 4, 3 }, { 6, 3 }, 10)
+    };
+
+    ElementsIndirectBuffer buffer(BufferUsage::Dynamic, commands);
+
+    EXPECT_NE(buffer.getNativeHandle(), ElementsIndirectBuffer::NullIndirectBuffer);
+    EXPECT_EQ(buffer.size(), 2u);
+    EXPECT_EQ(buffer.capacity(), 2 * sizeof(DrawElementsIndirectCommand));
+
+    auto stored = buffer.data();
+    ASSERT_EQ(stored.size(), 2u);
+    EXPECT_EQ(stored[1].count, 3u);
+    EXPECT_EQ(stored[1].instanceCount, 10u);
+    EXPECT_EQ(stored[1].baseVertex, 4);
+
+    buffer.bind();
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+
+    GLint bound = 0;
+    glGetIntegerv(GL_DRAW_INDIRECT_BUFFER_BINDING, &bound);
+    EXPECT_EQ(static_cast<unsigned int>(bound), buffer.getNativeHandle());
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, IndirectBuffer_MultiDrawOutOfRange)
+{
+    VertexBuffer vertices(BufferUsage::Static, 6);
+    VertexArray array(vertices);
+
+    ArraysIndirectBuffer commands(BufferUsage::Static, std::vector<DrawArraysIndirectCommand>{ makeDrawCommand({ 0, 3 }), makeDrawCommand({ 3, 3 }) });
+    RenderCanvas canvas;
+
+    EXPECT_THROW(canvas.multiDrawIndirect(Triangles, array, commands, { 1, 2 }), std::out_of_range);
+    EXPECT_THROW(canvas.multiDrawIndirectCount(Triangles, array, commands, commands, 0, 3), std::out_of_range);
+    EXPECT_THROW(canvas.multiDrawIndirectCount(Triangles, array, commands, commands, 2, 2), std::invalid_argument);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, IndirectBuffer_IndexedDrawWithoutElements)
+{
+    VertexBuffer vertices(BufferUsage::Static, 6);
+    VertexArray array(vertices);
+
+    ElementsIndirectBuffer commands(BufferUsage::Static, std::vector<DrawElementsIndirectCommand>{ makeDrawCommand({ 0, 3 }, { 0, 3 }) });
+    RenderCanvas canvas;
+
+    EXPECT_THROW(canvas.drawIndexed(Triangles, array), std::logic_error);
+    EXPECT_THROW(canvas.drawIndexedInstanced(Triangles, array, 2), std::logic_error);
+    EXPECT_THROW(canvas.multiDrawIndirect(Triangles, array, commands, { 0, 1 }), std::logic_error);
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <graphics/PackedFormats.hpp>
+#include <cmath>
+#include <limits>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST(PackedFormats, HalfExactValues)
+{
+    EXPECT_EQ(packHalf(0.0f), 0x0000);
+    EXPECT_EQ(packHalf(-0.0f), 0x8000);
+    EXPECT_EQ(packHalf(1.0f), 0x3C00);
+    EXPECT_EQ(packHalf(-2.0f), 0xC000);
+    EXPECT_EQ(packHalf(0.5f), 0x3800);
+    EXPECT_EQ(packHalf(65504.0f), 0x7BFF);
+
+    for (float value : { 0.0f, 1.0f, -2.0f, 0.5f, 0.25f, 1024.0f, 65504.0f })
+        EXPECT_EQ(unpackHalf(packHalf(value)), value);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(PackedFormats, HalfRangeAndRounding)
+{
+    EXPECT_EQ(packHalf(1e6f), 0x7C00);
+    EXPECT_EQ(packHalf(-std::numeric_limits<float>::infinity()), 0xFC00);
+    EXPECT_TRUE(std::isnan(unpackHalf(packHalf(std::numeric_limits<float>::quiet_NaN()))));
+
+    // Smallest subnormal half and values too small for it
+    EXPECT_EQ(packHalf(std::ldexp(1.0f, -24)), 0x0001);
+    EXPECT_EQ(unpackHalf(0x0001), std::ldexp(1.0f, -24));
+    EXPECT_EQ(packHalf(std::ldexp(1.0f, -26)), 0x0000);
+
+    // Halfway between 1 and the next half goes to the even one
+    EXPECT_EQ(packHalf(1.0f + std::ldexp(1.0f, -11)), 0x3C00);
+    EXPECT_EQ(packHalf(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3C02);
+
+    for (float value = -10.0f; value < 10.0f; value += 0.37f)
+        EXPECT_NEAR(unpackHalf(packHalf(value)), value, std::abs(value) * 0.001f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(PackedFormats, Unorm)
+{
+    EXPECT_EQ(packUnorm8(0.0f), 0);
+    EXPECT_EQ(packUnorm8(1.0f), 255);
+    EXPECT_EQ(packUnorm8(2.0f), 255);
+    EXPECT_EQ(packUnorm8(-1.0f), 0);
+    EXPECT_EQ(packUnorm8(0.5f), 128);
+    EXPECT_EQ(unpackUnorm8(255), 1.0f);
+
+    EXPECT_EQ(packUnorm16(1.0f), 65535);
+    EXPECT_NEAR(unpackUnorm16(packUnorm16(0.3f)), 0.3f, 1.0f / 65535);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(PackedFormats, PackedTypes)
+{
+    static_assert(sizeof(Half2) == 4 && sizeof(Half4) == 8);
+    static_assert(sizeof(Unorm8x4) == 4 && sizeof(Unorm16x2) == 4);
+
+    Unorm8x4 color(Vec4f(1.0f, 0.0f, 0.5f, 1.0f));
+    EXPECT_EQ(color.x, 255);
+    EXPECT_EQ(color.z, 128);
+
+    Half2 uv(Vec2f(0.25f, 0.75f));
+    EXPECT_EQ(uv.unpack(), Vec2f(0.25f, 0.75f));
+
+    constexpr VertexAttribute attribute = makeAttribute<Unorm8x4>(1, 0);
+    EXPECT_EQ(attribute.components, 4u);
+    EXPECT_TRUE(attribute.normalized);
+    EXPECT_FALSE(attribute.integer);
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <glad/glad.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/PackedVertex.hpp>
+#include <graphics/VertexArray.hpp>
+#include <graphics/VertexBuffer.hpp>
+#include <vector>
+
+using namespace bw;
+using namespace bw::low_level;
+
+static_assert(LayoutVertex<PackedVertex>);
+static_assert(LayoutVertex<CompactVertex>);
+
+TEST(PackedVertex, Sizes)
+{
+    EXPECT_EQ(sizeof(Vertex), 44u);
+    EXPECT_EQ(sizeof(PackedVertex), 20u);
+    EXPECT_EQ(sizeof(CompactVertex), 16u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(PackedVertex, RoundTrip)
+{
+    Vertex vertex(Vec3f(1.5f, -2.0f, 0.25f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f), Vec4f(0.5f, 0.25f, 0.0f, 0.0f));
+
+    Vertex packed = PackedVertex(vertex).unpack();
+    EXPECT_EQ(packed.position, vertex.position);
+    EXPECT_EQ(packed.color, vertex.color);
+    EXPECT_EQ(packed.texture, vertex.texture);
+
+    Vertex compact = CompactVertex(vertex).unpack();
+    EXPECT_EQ(compact.position, vertex.position);
+    EXPECT_EQ(compact.color, vertex.color);
+    EXPECT_NEAR(compact.texture.x, 0.5f, 1.0f / 65535);
+    EXPECT_NEAR(compact.texture.y, 0.25f, 1.0f / 65535);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, PackedVertex_VertexArrayFormats)
+{
+    std::vector<CompactVertex> vertices(3, CompactVertex(Vertex(Vec3f(0.0f, 1.0f, 0.0f), Vec4f(1.0f, 1.0f, 1.0f, 1.0f))));
+
+    BasicVertexBuffer<CompactVertex> vbo(BufferUsage::Static, vertices);
+    VertexArray vao(vbo);
+
+    EXPECT_EQ(vao.getStride(), sizeof(CompactVertex));
+
+    GLint type = 0, normalized = 0;
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 0, GL_VERTEX_ATTRIB_ARRAY_TYPE, &type);
+    EXPECT_EQ(type, GL_HALF_FLOAT);
+
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 2, GL_VERTEX_ATTRIB_ARRAY_TYPE, &type);
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 2, GL_VERTEX_ATTRIB_ARRAY_NORMALIZED, &normalized);
+    EXPECT_EQ(type, GL_UNSIGNED_SHORT);
+    EXPECT_EQ(normalized, GL_TRUE);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <graphics/SliceAllocator.hpp>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST(SliceAllocator, AllocateSequentially)
+{
+    SliceAllocator allocator(100);
+
+    auto first = allocator.allocate(30);
+    auto second = allocator.allocate(20);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(*first, BufferSlice(0, 30));
+    EXPECT_EQ(*second, BufferSlice(30, 20));
+    EXPECT_EQ(allocator.used(), 50u);
+    EXPECT_EQ(allocator.largestFree(), 50u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(SliceAllocator, AllocateTooLarge)
+{
+    SliceAllocator allocator(10);
+
+    EXPECT_FALSE(allocator.allocate(11).has_value());
+    EXPECT_EQ(allocator.used(), 0u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(SliceAllocator, FreeReusesMemory)
+{
+    SliceAllocator allocator(100);
+
+    auto first = allocator.allocate(40);
+    allocator.allocate(60);
+    allocator.free(*first);
+
+    auto reused = allocator.allocate(25);
+    ASSERT_TRUE(reused.has_value());
+    EXPECT_EQ(reused->offset, 0u);
+    EXPECT_EQ(allocator.used(), 85u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(SliceAllocator, FreeMergesNeighbours)
+{
+    SliceAllocator allocator(90);
+
+    auto a = allocator.allocate(30);
+    auto b = allocator.allocate(30);
+    auto c = allocator.allocate(30);
+
+    allocator.free(*a);
+    allocator.free(*c);
+    EXPECT_EQ(allocator.largestFree(), 30u);
+
+    allocator.free(*b);
+    EXPECT_EQ(allocator.largestFree(), 90u);
+    EXPECT_EQ(allocator.used(), 0u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(SliceAllocator, DoubleFreeThrows)
+{
+    SliceAllocator allocator(10);
+
+    auto slice = allocator.allocate(5);
+    allocator.free(*slice);
+
+    EXPECT_THROW(allocator.free(*slice), std::invalid_argument);
+    EXPECT_THROW(allocator.free({ 5, 10 }), std::out_of_range);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST(SliceAllocator, GrowExtendsFreeTail)
+{
+    SliceAllocator allocator(10);
+
+    allocator.allocate(4);
+    allocator.grow(20);
+
+    EXPECT_EQ(allocator.capacity(), 20u);
+    EXPECT_EQ(allocator.largestFree(), 16u);
+    EXPECT_EQ(allocator.allocate(16)->offset, 4u);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <glad/glad.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/TypedBuffer.hpp>
+#include <graphics/VertexBuffer.hpp>
+#include <graphics/ElementBuffer.hpp>
+#include <vector>
+
+using namespace bw;
+using namespace bw::low_level;
+
+struct Particle
+{
+    float position[4];
+    float velocity[4];
+
+    bool operator==(const Particle&) const = default;
+};
+
+static_assert(std::is_trivially_copyable_v<Vertex>);
+
+TEST_F(OpenGLTestEnvironment, TypedBuffer_StorageBuffer)
+{
+    std::vector<Particle> particles = {
+        { { 0.0f, 1.0f, 2.0f, 1.0f }, { 1.0f, 0.0f, 0.0f, 0.0f } },
+        { { 3.0f, 4.0f, 5.0f, 1.0f }, { 0.0f, 1.0f, 0.0f, 0.0f } }
+    };
+
+    StorageBuffer<Particle> buffer(BufferUsage::Dynamic, particles);
+
+    EXPECT_NE(buffer.getNativeHandle(), StorageBuffer<Particle>::NullBuffer);
+    EXPECT_EQ(buffer.size(), 2u);
+    EXPECT_EQ(buffer.capacity(), 2 * sizeof(Particle));
+    EXPECT_EQ(buffer.data(), particles);
+
+    particles[1].velocity[2] = 5.0f;
+    buffer.update(1, std::span<const Particle>(particles).subspan(1));
+    EXPECT_EQ(buffer.data(), particles);
+
+    buffer.bindBase(0);
+    buffer.bindRange(1, 1, 1);
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+
+    GLint bound = 0;
+    glGetIntegeri_v(GL_SHADER_STORAGE_BUFFER_BINDING, 0, &bound);
+    EXPECT_EQ(static_cast<unsigned int>(bound), buffer.getNativeHandle());
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, TypedBuffer_UniformBufferShadow)
+{
+    UniformBuffer<float> buffer(BufferUsage::Dynamic, 16);
+
+    buffer.enableShadow();
+    buffer.generate(0, 16, [](size_t i) { return static_cast<float>(i); });
+    buffer.flush();
+    buffer.disableShadow();
+
+    auto values = buffer.data();
+    for (size_t i = 0; i < values.size(); i++)
+        EXPECT_EQ(values[i], static_cast<float>(i));
+
+    buffer.reserve(32);
+    EXPECT_EQ(buffer.size(), 32u);
+    EXPECT_EQ(buffer.data(0, 16), values);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, TypedBuffer_SharedByVertexAndElementBuffers)
+{
+    VertexBuffer vertices(BufferUsage::Static, 4);
+    ElementBuffer indices(BufferUsage::Static, 6);
+
+    TypedBuffer<Vertex, ArrayTarget>& vertexStorage = vertices;
+    TypedBuffer<unsigned int, ElementArrayTarget>& indexStorage = indices;
+
+    EXPECT_EQ(vertexStorage.size(), 4u);
+    EXPECT_EQ(indexStorage.size(), 6u);
+    EXPECT_EQ(VertexBuffer::TargetType, ArrayTarget);
+    EXPECT_EQ(ElementBuffer::TargetType, ElementArrayTarget);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <glad/glad.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/UploadManager.hpp>
+#include <vector>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST_F(OpenGLTestEnvironment, UploadManager_UploadAndSubmit)
+{
+    UploadManager manager(1024);
+    ElementBuffer buffer(BufferUsage::Static, 4);
+    
+    std::vector<unsigned int> indices = { 1, 2, 3, 4 };
+    EXPECT_TRUE(manager.upload(buffer, 0, indices));
+    EXPECT_EQ(manager.getPendingBytes(), 4 * sizeof(unsigned int));
+    
+    manager.submit();
+    
+    EXPECT_EQ(manager.getPendingBytes(), 0u);
+    EXPECT_EQ(buffer.data(), indices);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, UploadManager_FrameBudget)
+{
+    UploadManager manager(1024, 2 * sizeof(unsigned int));
+    ElementBuffer buffer(BufferUsage::Static, 4);
+    
+    std::vector<unsigned int> indices = { 5, 6, 7, 8 };
+    manager.upload(buffer, 0, indices);
+    
+    manager.submit();
+    EXPECT_EQ(manager.getPendingBytes(), 2 * sizeof(unsigned int));
+    EXPECT_EQ(buffer.data(0, 2), std::vector<unsigned int>({ 5, 6 }));
+    
+    manager.submit();
+    EXPECT_EQ(manager.getPendingBytes(), 0u);
+    EXPECT_EQ(buffer.data(), indices);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, UploadManager_StagingReuse)
+{
+    UploadManager manager(4 * sizeof(unsigned int));
+    ElementBuffer buffer(BufferUsage::Static, 8);
+    
+    std::vector<unsigned int> first = { 1, 2, 3, 4 };
+    std::vector<unsigned int> second = { 5, 6, 7, 8 };
+    
+    EXPECT_TRUE(manager.upload(buffer, 0, first));
+    EXPECT_FALSE(manager.upload(buffer, 4, second));
+    
+    manager.submitAll();
+    glFinish();
+    
+    // The next submit reclaims the staging memory of the finished copies
+    manager.submit();
+    EXPECT_TRUE(manager.upload(buffer, 4, second));
+    manager.submitAll();
+    
+    EXPECT_EQ(buffer.data(4, 4), second);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, UploadManager_UploadVertices)
+{
+    UploadManager manager;
+    VertexBuffer buffer(BufferUsage::Static, 2);
+    
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f))
+    };
+    
+    EXPECT_TRUE(manager.upload(buffer, 0, vertices));
+    manager.submitAll();
+    
+    EXPECT_EQ(buffer.data()[1].position.x, 2.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, UploadManager_InvalidDestination)
+{
+    UploadManager manager(1024);
+    ElementBuffer buffer(BufferUsage::Static, 4);
+
+    std::vector<unsigned int> indices = { 1, 2, 3 };
+    EXPECT_THROW(manager.upload(buffer, 2, indices), std::out_of_range);
+
+    buffer.enableShadow();
+    EXPECT_THROW(manager.upload(buffer, 0, indices), std::invalid_argument);
+    EXPECT_EQ(manager.getPendingBytes(), 0u);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/VertexBuffer.hpp>
+#include <graphics/VBMapContext.hpp>
+#include <graphics/EBMapContext.hpp>
+#include <algorithm>
+#include <ranges>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST_F(OpenGLTestEnvironment, VBMapContext_MapAndUnmap)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 4);
+    VBMapContext context(buffer);
+    
+    EXPECT_FALSE(context.isMapped());
+    
+    context.map(MapAccess::WriteOnly);
+    EXPECT_TRUE(context.isMapped());
+    
+    context.unmap();
+    EXPECT_FALSE(context.isMapped());
+    EXPECT_FALSE(context.tryGet(0).has_value());
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBMapContext_WriteThroughMapping)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 2);
+    
+    {
+        VBMapContext context(buffer);
+        context.map(MapAccess::WriteOnly);
+        
+        context[0] = Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f));
+        context[1] = Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f));
+        
+        EXPECT_TRUE(context.tryGet(1).has_value());
+        EXPECT_FALSE(context.tryGet(2).has_value());
+    }
+    
+    auto retrievedData = buffer.data();
+    EXPECT_FLOAT_EQ(retrievedData[0].position.x, 1.0f);
+    EXPECT_FLOAT_EQ(retrievedData[1].position.x, 2.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBMapContext_MoveConstructor)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 2);
+    VBMapContext original(buffer);
+    original.map(MapAccess::WriteOnly);
+    
+    VBMapContext moved(std::move(original));
+    
+    EXPECT_TRUE(moved.isMapped());
+    EXPECT_FALSE(original.isMapped());
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBMapContext_MapRange)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 8);
+    
+    {
+        VBMapContext context(buffer);
+        context.mapRange(4, 2, MapAccess::WriteOnly, MapFlags::InvalidateRange);
+        
+        EXPECT_TRUE(context.isMapped());
+        EXPECT_TRUE(context.tryGet(1).has_value());
+        EXPECT_FALSE(context.tryGet(2).has_value());
+        
+        context[0] = Vertex(Vec3f(5.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f));
+        context[1] = Vertex(Vec3f(6.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f));
+    }
+    
+    auto retrievedData = buffer.data(4, 2);
+    EXPECT_FLOAT_EQ(retrievedData[0].position.x, 5.0f);
+    EXPECT_FLOAT_EQ(retrievedData[1].position.x, 6.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBMapContext_MapRangeWithExplicitFlush)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 8);
+    
+    {
+        VBMapContext context(buffer);
+        context.mapRange(0, 8, MapAccess::WriteOnly, MapFlags::FlushExplicit | MapFlags::Unsynchronized);
+        
+        context[3] = Vertex(Vec3f(3.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f));
+        context.flushRange(3, 1);
+    }
+    
+    EXPECT_FLOAT_EQ(buffer.data(3, 1)[0].position.x, 3.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBMapContext_ContiguousRange)
+{
+    static_assert(std::ranges::contiguous_range<VBMapContext>);
+    static_assert(std::ranges::contiguous_range<EBMapContext>);
+
+    VertexBuffer buffer(BufferUsage::Dynamic, 4);
+    VBMapContext context(buffer);
+    
+    EXPECT_TRUE(context.span().empty());
+    
+    Vertex vertex(Vec3f(7.0f, 0.0f, 0.0f), Vec4f(1.0f, 1.0f, 1.0f, 1.0f));
+    
+    context.map(MapAccess::WriteOnly);
+    EXPECT_EQ(context.size(), 4u);
+    std::ranges::fill(context, vertex);
+    context.unmap();
+    
+    auto data = buffer.data();
+    EXPECT_EQ(data[0].position.x, 7.0f);
+    EXPECT_EQ(data[3].position.x, 7.0f);
+}
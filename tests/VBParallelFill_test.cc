@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "OpenGLTestEnvironment.hpp"
+#include <graphics/VertexBuffer.hpp>
+#include <graphics/VBParallelFill.hpp>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace bw;
+using namespace bw::low_level;
+
+TEST_F(OpenGLTestEnvironment, VBParallelFill_Chunks)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 10);
+    VBParallelFill fill(buffer, 0, 10, 3);
+    
+    EXPECT_EQ(fill.getChunkCount(), 3u);
+    EXPECT_EQ(fill.getChunk(0).size(), 4u);
+    EXPECT_EQ(fill.getChunk(1).size(), 3u);
+    EXPECT_EQ(fill.getChunk(2).size(), 3u);
+    EXPECT_EQ(fill.getChunk(0).data() + 4, fill.getChunk(1).data());
+    
+    for (size_t i = 0; i < fill.getChunkCount(); i++)
+    {
+        fill.arrive();
+    }
+    fill.finish();
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBParallelFill_Run)
+{
+    const size_t count = 1000;
+    VertexBuffer buffer(BufferUsage::Dynamic, count);
+    
+    {
+        VBParallelFill fill(buffer, 0, count, 4);
+        fill.run([](std::span<Vertex> chunk, size_t index) {
+            std::ranges::fill(chunk, Vertex(Vec3f(static_cast<float>(index), 0.0f, 0.0f), Vec4f(1.0f, 1.0f, 1.0f, 1.0f)));
+        });
+    }
+    
+    auto data = buffer.data();
+    EXPECT_EQ(data[0].position.x, 0.0f);
+    EXPECT_EQ(data[count - 1].position.x, 3.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBParallelFill_WorkerThreads)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 64);
+    VBParallelFill fill(buffer, 32, 32, 2);
+    
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < fill.getChunkCount(); i++)
+    {
+        workers.emplace_back([&fill, i]() {
+            for (auto& vertex : fill.getChunk(i))
+            {
+                vertex.position = Vec3f(1.0f, 2.0f, 3.0f);
+            }
+            fill.arrive();
+        });
+    }
+    
+    fill.finish();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    
+    EXPECT_EQ(buffer.data(32, 32)[31].position.z, 3.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBParallelFill_OutOfRange)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 8);
+    
+    EXPECT_THROW(VBParallelFill(buffer, 4, 8, 2), std::out_of_range);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBParallelFill_ChunkOutOfRange)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 8);
+    VBParallelFill fill(buffer, 0, 8, 2);
+
+    EXPECT_THROW(fill.getChunk(2), std::out_of_range);
+
+    // No chunk was taken, so the fill is abandoned without waiting for the workers
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VBParallelFill_WorkerException)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 16);
+    VBParallelFill fill(buffer, 0, 16, 4);
+
+    EXPECT_THROW(fill.run([](std::span<Vertex>, size_t index) {
+        if (index == 2)
+            throw std::runtime_error("Worker failed");
+    }), std::runtime_error);
+
+    // The buffer is unmapped even though one of the workers failed
+    EXPECT_EQ(buffer.data().size(), 16u);
+}
@@ -3,10 +3,46 @@
 #include <graphics/VertexArray.hpp>
 #include <graphics/VertexBuffer.hpp>
 #include <graphics/ElementBuffer.hpp>
+#include <glad/glad.h>
+#include <cstddef>
 
 using namespace bw;
 using namespace bw::low_level;
 
+struct LeanVertex
+{
+    Vec2f position;
+    std::uint8_t color[4];
+};
+
+template <>
+struct bw::low_level::VertexLayout<LeanVertex>
+{
+    static constexpr std::array Attributes = {
+        makeAttribute<Vec2f>(0, offsetof(LeanVertex, position)),
+        makeAttribute<std::uint8_t[4]>(1, offsetof(LeanVertex, color), true)
+    };
+};
+
+struct SpriteInstance
+{
+    Vec4f transform;
+    Vec4f color;
+};
+
+template <>
+struct bw::low_level::VertexLayout<SpriteInstance>
+{
+    static constexpr std::array Attributes = {
+        makeAttribute<Vec4f>(3, offsetof(SpriteInstance, transform)),
+        makeAttribute<Vec4f>(4, offsetof(SpriteInstance, color))
+    };
+};
+
+static_assert(LayoutVertex<Vertex>);
+static_assert(LayoutVertex<LeanVertex>);
+static_assert(!LayoutVertex<int>);
+
 TEST_F(OpenGLTestEnvironment, VertexArray_DefaultConstructor)
 {
     VertexArray vao;
@@ -147,7 +183,7 @@ TEST_F(OpenGLTestEnvironment, VertexArray_BindToBothBuffers)
         Vertex(Vec3f(0.0f, 1.0f, 0.0f), Vec4f(0.0f, 0.0f, 1.0f, 1.0f))
     };
     
-    std::vector<size_t> indices = {0, 1, 2};
+    std::vector<unsigned int> indices = {0, 1, 2};
     
     VertexBuffer vbo(BufferUsage::Static, vertices);
     ElementBuffer ebo(BufferUsage::Static, indices);
@@ -264,7 +300,7 @@ TEST_F(OpenGLTestEnvironment, VertexArray_GetCurrentBuffers)
         Vertex(Vec3f(0.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f))
     };
     
-    std::vector<size_t> indices = {0};
+    std::vector<unsigned int> indices = {0};
     
     VertexBuffer vbo(BufferUsage::Static, vertices);
     ElementBuffer ebo(BufferUsage::Static, indices);
@@ -274,3 +310,204 @@ TEST_F(OpenGLTestEnvironment, VertexArray_GetCurrentBuffers)
     
     EXPECT_EQ(vao.getCurrentVertexBuffer(), &vbo);
 }
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexArray_BindElements)
+{
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(0.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(0.0f, 1.0f, 0.0f), Vec4f(0.0f, 0.0f, 1.0f, 1.0f))
+    };
+    
+    std::vector<unsigned short> indices = {0, 1, 2, 2, 1, 0};
+    
+    VertexBuffer vbo(BufferUsage::Static, vertices);
+    ElementBuffer16 ebo(BufferUsage::Static, indices);
+    VertexArray vao(vbo);
+    
+    EXPECT_FALSE(vao.hasElements());
+    
+    vao.bindElements(ebo, {3, 3});
+    
+    EXPECT_TRUE(vao.hasElements());
+    EXPECT_EQ(vao.getIndexType(), ElementBuffer16::IndexType);
+    EXPECT_EQ(vao.getElementRange().start, 3u);
+    EXPECT_EQ(vao.getElementRange().count, 3u);
+    
+    VertexArray copy(vao);
+    EXPECT_TRUE(copy.hasElements());
+    EXPECT_EQ(copy.getElementRange().count, 3u);
+    
+    vao.release();
+    EXPECT_FALSE(vao.hasElements());
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexArray_CustomVertexLayout)
+{
+    std::vector<LeanVertex> vertices = {
+        { Vec2f(0.0f, 0.0f), { 255, 0, 0, 255 } },
+        { Vec2f(1.0f, 0.0f), { 0, 255, 0, 255 } },
+        { Vec2f(0.0f, 1.0f), { 0, 0, 255, 255 } }
+    };
+
+    BasicVertexBuffer<LeanVertex> vbo(BufferUsage::Static, vertices);
+    VertexArray vao(vbo);
+
+    EXPECT_EQ(vao.getStride(), sizeof(LeanVertex));
+    EXPECT_EQ(vao.getLayout().size(), 2u);
+    EXPECT_EQ(vao.getRange().count, 3u);
+    EXPECT_EQ(vao.getCurrentVertexBuffer(), nullptr);
+
+    GLint enabled = 0, size = 0, type = 0, normalized = 0;
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 1, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 1, GL_VERTEX_ATTRIB_ARRAY_SIZE, &size);
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 1, GL_VERTEX_ATTRIB_ARRAY_TYPE, &type);
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 1, GL_VERTEX_ATTRIB_ARRAY_NORMALIZED, &normalized);
+    EXPECT_EQ(enabled, GL_TRUE);
+    EXPECT_EQ(size, 4);
+    EXPECT_EQ(type, GL_UNSIGNED_BYTE);
+    EXPECT_EQ(normalized, GL_TRUE);
+
+    // Texture coordinates of the full vertex are disabled when the lean layout is bound
+    VertexBuffer full(BufferUsage::Static, 3);
+    VertexArray other(full);
+    other.bindTo(vbo);
+    glGetVertexArrayIndexediv(other.getNativeHandle(), 2, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+    EXPECT_EQ(enabled, GL_FALSE);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexArray_MultipleStreams)
+{
+    std::vector<Vec3f> positions = { Vec3f(0.0f, 0.0f, 0.0f), Vec3f(1.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f) };
+    std::vector<Vec4f> colors(3, Vec4f(1.0f, 1.0f, 1.0f, 1.0f));
+
+    BasicVertexBuffer<Vec3f> positionBuffer(BufferUsage::Stream, positions);
+    BasicVertexBuffer<Vec4f> colorBuffer(BufferUsage::Static, colors);
+
+    VertexArray vao;
+    vao.bindStream(0, positionBuffer, makeAttribute<Vec3f>(0, 0));
+    vao.bindStream(1, colorBuffer, makeAttribute<Vec4f>(1, 0), 1);
+    vao.setRange({ 0, 2 });
+
+    ASSERT_EQ(vao.getStreams().size(), 2u);
+    EXPECT_EQ(vao.getStreams()[0].stride, sizeof(Vec3f));
+    EXPECT_EQ(vao.getStreams()[1].stride, sizeof(Vec4f));
+    EXPECT_EQ(vao.getStreams()[1].offset, sizeof(Vec4f));
+    EXPECT_EQ(vao.getRange().count, 2u);
+
+    GLint binding = -1;
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 1, GL_VERTEX_ATTRIB_BINDING, &binding);
+    EXPECT_EQ(binding, 1);
+
+    // Copies rebind every stream
+    VertexArray copy(vao);
+    EXPECT_EQ(copy.getStreams().size(), 2u);
+
+    vao.unbindStream(1);
+    GLint enabled = GL_TRUE;
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 1, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+    EXPECT_EQ(enabled, GL_FALSE);
+    EXPECT_EQ(vao.getStreams().size(), 1u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexArray_StreamTakesAttributeLocation)
+{
+    VertexBuffer vbo(BufferUsage::Static, 3);
+    BasicVertexBuffer<Vec4f> colorBuffer(BufferUsage::Dynamic, 3);
+
+    // Colors of the interleaved vertices are replaced by the separate stream
+    VertexArray vao(vbo);
+    vao.bindStream(1, colorBuffer, makeAttribute<Vec4f>(1, 0));
+
+    EXPECT_EQ(vao.getLayout().size(), 2u);
+    EXPECT_EQ(vao.getCurrentVertexBuffer(), &vbo);
+
+    GLint binding = -1;
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 1, GL_VERTEX_ATTRIB_BINDING, &binding);
+    EXPECT_EQ(binding, 1);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexArray_Instances)
+{
+    std::vector<SpriteInstance> instances(100, { Vec4f(0.0f, 0.0f, 1.0f, 1.0f), Vec4f(1.0f, 1.0f, 1.0f, 1.0f) });
+
+    VertexBuffer quad(BufferUsage::Static, 4);
+    BasicVertexBuffer<SpriteInstance> instanceBuffer(BufferUsage::Dynamic, instances);
+
+    VertexArray vao(quad);
+    vao.bindInstances(1, instanceBuffer);
+
+    GLint divisor = 0;
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 4, GL_VERTEX_ATTRIB_ARRAY_DIVISOR, &divisor);
+    EXPECT_EQ(divisor, 1);
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 0, GL_VERTEX_ATTRIB_ARRAY_DIVISOR, &divisor);
+    EXPECT_EQ(divisor, 0);
+
+    vao.setDivisor(1, 4);
+    glGetVertexArrayIndexediv(vao.getNativeHandle(), 3, GL_VERTEX_ATTRIB_ARRAY_DIVISOR, &divisor);
+    EXPECT_EQ(divisor, 4);
+    EXPECT_EQ(vao.getStreams()[1].divisor, 4u);
+
+    EXPECT_THROW(vao.setDivisor(7, 1), std::invalid_argument);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexArray_CopyAssignmentDropsStreams)
+{
+    std::vector<SpriteInstance> instances(10, { Vec4f(0.0f, 0.0f, 1.0f, 1.0f), Vec4f(1.0f, 1.0f, 1.0f, 1.0f) });
+
+    VertexBuffer quad(BufferUsage::Static, 4);
+    BasicVertexBuffer<SpriteInstance> instanceBuffer(BufferUsage::Dynamic, instances);
+
+    VertexArray instanced(quad);
+    instanced.bindInstances(1, instanceBuffer);
+    ASSERT_EQ(instanced.getStreams().size(), 2u);
+
+    VertexArray plain(quad);
+    instanced = plain;
+
+    ASSERT_EQ(instanced.getStreams().size(), 1u);
+    EXPECT_EQ(instanced.getStreams()[0].binding, 0u);
+
+    GLint enabled = GL_TRUE;
+    glGetVertexArrayIndexediv(instanced.getNativeHandle(), 3, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+    EXPECT_EQ(enabled, GL_FALSE);
+    glGetVertexArrayIndexediv(instanced.getNativeHandle(), 0, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+    EXPECT_EQ(enabled, GL_TRUE);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexArray_CopyAssignmentDropsElements)
+{
+    std::vector<unsigned short> indices = {0, 1, 2};
+
+    VertexBuffer vbo(BufferUsage::Static, 3);
+    ElementBuffer16 ebo(BufferUsage::Static, indices);
+
+    VertexArray indexed(vbo);
+    indexed.bindElements(ebo);
+    ASSERT_TRUE(indexed.hasElements());
+
+    VertexArray plain(vbo);
+    indexed = plain;
+
+    EXPECT_FALSE(indexed.hasElements());
+    EXPECT_EQ(indexed.getIndexType(), 0u);
+    EXPECT_EQ(indexed.getElementRange().count, 0u);
+
+    GLint bound = -1;
+    glGetVertexArrayiv(indexed.getNativeHandle(), GL_ELEMENT_ARRAY_BUFFER_BINDING, &bound);
+    EXPECT_EQ(bound, 0);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "OpenGLTestEnvironment.hpp"
 #include <graphics/VertexBuffer.hpp>
+#include <array>
 
 using namespace bw;
 using namespace bw::low_level;
@@ -242,3 +243,264 @@ TEST_F(OpenGLTestEnvironment, VertexBuffer_Release)
     
     EXPECT_EQ(buffer.getNativeHandle(), VertexBuffer::NullVertexBuffer);
 }
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_StreamConstructor)
+{
+    VertexBuffer buffer(BufferUsage::Stream, 16, 3);
+    
+    EXPECT_TRUE(buffer.isStreaming());
+    EXPECT_EQ(buffer.getFrameSize(), 16u);
+    EXPECT_EQ(buffer.size(), 48u);
+    EXPECT_EQ(buffer.getUsage(), BufferUsage::Stream);
+    EXPECT_EQ(buffer.getFrame().size(), 16u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_StreamConstructorWithoutStreamUsage)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 16, 3);
+    
+    EXPECT_FALSE(buffer.isStreaming());
+    EXPECT_EQ(buffer.size(), 48u);
+    EXPECT_TRUE(buffer.getFrame().empty());
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_StreamFrameRing)
+{
+    VertexBuffer buffer(BufferUsage::Stream, 4, 3);
+    
+    EXPECT_EQ(buffer.getFrameOffset(), 0u);
+    buffer.nextFrame();
+    EXPECT_EQ(buffer.getFrameOffset(), 4u);
+    buffer.nextFrame();
+    EXPECT_EQ(buffer.getFrameOffset(), 8u);
+    buffer.nextFrame();
+    EXPECT_EQ(buffer.getFrameOffset(), 0u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_StreamUpdate)
+{
+    VertexBuffer buffer(BufferUsage::Stream, 2, 2);
+    
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f))
+    };
+    
+    buffer.nextFrame();
+    buffer.update(vertices);
+    
+    auto retrievedData = buffer.data(buffer.getFrameOffset(), 2);
+    EXPECT_FLOAT_EQ(retrievedData[0].position.x, 1.0f);
+    EXPECT_FLOAT_EQ(retrievedData[1].position.x, 2.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_StreamKeepsHandle)
+{
+    VertexBuffer buffer(BufferUsage::Stream, 4, 2);
+    unsigned int handle = buffer.getNativeHandle();
+    
+    EXPECT_THROW(buffer.reserve(16), std::logic_error);
+    EXPECT_EQ(buffer.getNativeHandle(), handle);
+    EXPECT_EQ(buffer.size(), 8u);
+    
+    EXPECT_THROW(VertexBuffer(BufferUsage::Stream, 4, 0), std::invalid_argument);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_StreamCopyToShadow)
+{
+    VertexBuffer buffer(BufferUsage::Stream, 2, 2);
+    
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f))
+    };
+    buffer.update(vertices);
+    
+    // The shadowed destination is written on the CPU side, the stream ring is read through the driver
+    VertexBuffer target(BufferUsage::Dynamic, 4);
+    target.enableShadow();
+    buffer.copyTo(target);
+    
+    EXPECT_FLOAT_EQ(target.data()[1].position.x, 2.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_ReserveKeepsData)
+{
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f))
+    };
+    
+    VertexBuffer buffer(BufferUsage::Static, vertices);
+    unsigned int handle = buffer.getNativeHandle();
+    
+    buffer.reserve(10);
+    
+    EXPECT_EQ(buffer.getNativeHandle(), handle);
+    EXPECT_EQ(buffer.size(), 10u);
+    
+    auto retrievedData = buffer.data(0, 2);
+    EXPECT_FLOAT_EQ(retrievedData[0].position.x, 1.0f);
+    EXPECT_FLOAT_EQ(retrievedData[1].position.x, 2.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_ReadAsync)
+{
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(3.0f, 0.0f, 0.0f), Vec4f(0.0f, 0.0f, 1.0f, 1.0f))
+    };
+    
+    VertexBuffer buffer(BufferUsage::Static, vertices);
+    
+    auto readback = buffer.readAsync(1, 2);
+    EXPECT_EQ(readback.size(), 2u);
+    
+    readback.wait();
+    EXPECT_TRUE(readback.isReady());
+    
+    auto retrievedData = readback.get();
+    EXPECT_EQ(retrievedData.size(), 2u);
+    EXPECT_FLOAT_EQ(retrievedData[0].position.x, 2.0f);
+    EXPECT_FLOAT_EQ(retrievedData[1].position.x, 3.0f);
+
+    EXPECT_THROW(buffer.readAsync(2, 2), std::out_of_range);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_ReadAsyncRing)
+{
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f))
+    };
+    
+    VertexBuffer buffer(BufferUsage::Static, vertices);
+    ReadbackRing ring(1024, 2);
+    
+    auto first = buffer.readAsync(ring, 0, 2);
+    auto second = buffer.readAsync(ring, 1, 1);
+    EXPECT_FLOAT_EQ(first.get()[1].position.x, 2.0f);
+    EXPECT_FLOAT_EQ(second.get()[0].position.x, 2.0f);
+    
+    // The readbacks stay valid for the frame count of the ring
+    ring.nextFrame();
+    EXPECT_FALSE(first.isExpired());
+    ring.nextFrame();
+    EXPECT_TRUE(first.isExpired());
+    EXPECT_THROW(first.get(), std::logic_error);
+    
+    // Readbacks larger than the segment get their own staging buffer
+    ReadbackRing small(sizeof(Vertex) * 2, 2);
+    auto standalone = buffer.readAsync(small, 0, 2);
+    small.nextFrame();
+    small.nextFrame();
+    EXPECT_FALSE(standalone.isExpired());
+    EXPECT_FLOAT_EQ(standalone.get()[0].position.x, 1.0f);
+    
+    EXPECT_THROW(buffer.readAsync(ring, 1, 2), std::out_of_range);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_UpdateDiscard)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 4);
+    auto handle = buffer.getNativeHandle();
+    
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f))
+    };
+    
+    buffer.updateDiscard(vertices);
+    
+    EXPECT_EQ(buffer.getNativeHandle(), handle);
+    EXPECT_EQ(buffer.size(), 4u);
+    EXPECT_EQ(buffer.data(0, 2)[1].position.x, 2.0f);
+    
+    std::vector<Vertex> larger(6);
+    buffer.updateDiscard(larger);
+    
+    EXPECT_EQ(buffer.size(), 6u);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_ShadowFlush)
+{
+    VertexBuffer buffer(BufferUsage::Dynamic, 8);
+    buffer.enableShadow();
+    EXPECT_TRUE(buffer.hasShadow());
+    
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(5.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f))
+    };
+    
+    buffer.update(2, vertices);
+    buffer.update(3, vertices);
+    buffer.flush();
+    
+    auto stats = buffer.getShadowStats();
+    EXPECT_EQ(stats.uploadCount, 1u);
+    EXPECT_EQ(stats.bytesTouched, 2 * sizeof(Vertex));
+    
+    buffer.disableShadow();
+    EXPECT_EQ(buffer.data(3, 1)[0].position.x, 5.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_ReadInto)
+{
+    const std::vector<Vertex> vertices = {
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f))
+    };
+    VertexBuffer buffer(BufferUsage::Static, vertices);
+    
+    std::array<Vertex, 1> out;
+    buffer.readInto(out, 1);
+    
+    EXPECT_EQ(out[0].position.x, 2.0f);
+}
+
+////////////////////////////////////////////////////////////
+
+TEST_F(OpenGLTestEnvironment, VertexBuffer_CopyRanges)
+{
+    std::vector<Vertex> vertices = {
+        Vertex(Vec3f(1.0f, 0.0f, 0.0f), Vec4f(1.0f, 0.0f, 0.0f, 1.0f)),
+        Vertex(Vec3f(2.0f, 0.0f, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f))
+    };
+    VertexBuffer source(BufferUsage::Static, vertices);
+    VertexBuffer destination(BufferUsage::Static, 4);
+    
+    std::vector<CopyRegion> regions = { { 0, 2, 1 }, { 1, 3, 1 } };
+    source.copyRanges(destination, regions);
+    
+    auto data = destination.data(2, 2);
+    EXPECT_EQ(data[0].position.x, 1.0f);
+    EXPECT_EQ(data[1].position.x, 2.0f);
+    
+    std::vector<CopyRegion> outside = { { 1, 3, 2 } };
+    EXPECT_THROW(source.copyRanges(destination, outside), std::out_of_range);
+}